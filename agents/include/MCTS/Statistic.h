@@ -80,6 +80,16 @@ namespace mcts
 			PrintRate(ss, iterate_);
 			ss << std::endl;
 
+			auto const& value_cache = policy::simulation::StateValueCache::GetInstance();
+			uint64_t value_cache_hits = value_cache.GetHits();
+			uint64_t value_cache_total = value_cache_hits + value_cache.GetMisses();
+			ss << "State value cache hit rate: "
+				<< value_cache_hits << " / " << value_cache_total;
+			if (value_cache_total > 0) {
+				ss << " (" << 100.0 * value_cache_hits / value_cache_total << "%)";
+			}
+			ss << std::endl;
+
 			return ss.str();
 		}
 
@@ -129,7 +129,7 @@ namespace mcts
 					return "Opponent Hero";
 				}
 
-				auto FindInMinions = [&](std::vector<state::CardRef> const& minions) -> int {
+				auto FindInMinions = [&](state::board::Minions::Container const& minions) -> int {
 					for (size_t i = 0; i < minions.size(); ++i) {
 						if (minions[i] == card_ref) return (int)i;
 					}
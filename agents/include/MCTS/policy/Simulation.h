@@ -3,7 +3,9 @@
 #include <random>
 #include "engine/view/Board.h"
 #include "MCTS/policy/RandomByRand.h"
+#include "MCTS/policy/StateValueCache.h"
 #include "neural_net/NeuralNetwork.h"
+#include "neural_net/StateDataBridge.h"
 
 namespace mcts
 {
@@ -141,7 +143,7 @@ namespace mcts
 			{
 			public:
 				NeuralNetworkStateValueFunction()
-					: filename_(), net_(), current_player_viewer_()
+					: filename_(), net_(), model_id_(0), current_player_viewer_()
 				{
 					filename_ = "simulation_net";
 					LoadNetwork();
@@ -149,6 +151,7 @@ namespace mcts
 
 				void LoadNetwork() {
 					net_.InitializePredict(filename_);
+					model_id_ = StateValueCache::GetModelId(filename_);
 				}
 
 				// State value is in range [-1, 1]
@@ -160,9 +163,14 @@ namespace mcts
 				}
 
 				double GetStateValue(state::State const& state) {
-					current_player_viewer_.Reset(state);
-
-					double score = net_.Predict(&current_player_viewer_);
+					// The network evaluates the board from the current player's point of view
+					uint64_t board_hash = GetBoardHash(state);
+					double score = 0.0;
+					if (!StateValueCache::GetInstance().Get(model_id_, board_hash, &score)) {
+						current_player_viewer_.Reset(state);
+						score = net_.Predict(&current_player_viewer_);
+						StateValueCache::GetInstance().Put(model_id_, board_hash, score);
+					}
 
 					if (!state.GetCurrentPlayerId().IsFirst()) {
 						score = -score;
@@ -175,193 +183,15 @@ namespace mcts
 				}
 
 			private:
-				class StateDataBridge : public neural_net::NeuralNetworkWrapper::IInputGetter
-				{
-				public:
-					StateDataBridge() : state_(nullptr), attackable_indics_(),
-						playable_cards_(), hero_power_playable_()
-					{}
-
-					StateDataBridge(StateDataBridge const&) = delete;
-					StateDataBridge & operator=(StateDataBridge const&) = delete;
-
-					void Reset(state::State const& state) {
-						state_ = &state;
-
-						engine::FlowControl::ValidActionGetter valid_action(*state_);
-
-						attackable_indics_.clear();
-						valid_action.ForEachAttacker([this](int encoded_idx) {
-							attackable_indics_.push_back(encoded_idx);
-							return true;
-						});
-
-						playable_cards_.clear();
-						valid_action.ForEachPlayableCard([&](size_t idx) {
-							playable_cards_.push_back((int)idx);
-							return true;
-						});
-
-						hero_power_playable_ = valid_action.CanUseHeroPower();
-					}
-
-					double GetField(
-						neural_net::NeuralNetworkWrapper::FieldSide field_side,
-						neural_net::NeuralNetworkWrapper::FieldType field_type,
-						int arg1 = 0) override final
-					{
-						if (field_side == neural_net::NeuralNetworkWrapper::kCurrent) {
-							return GetSideField(field_type, arg1, state_->GetCurrentPlayer());
-						}
-						else if (field_side == neural_net::NeuralNetworkWrapper::kOpponent) {
-							return GetSideField(field_type, arg1, state_->GetOppositePlayer());
-						}
-						throw std::runtime_error("invalid side");
-					}
-
-				private:
-					double GetSideField(neural_net::NeuralNetworkWrapper::FieldType field_type, int arg1, state::board::Player const& player) {
-						switch (field_type) {
-						case neural_net::NeuralNetworkWrapper::kResourceCurrent:
-						case neural_net::NeuralNetworkWrapper::kResourceTotal:
-						case neural_net::NeuralNetworkWrapper::kResourceOverload:
-						case neural_net::NeuralNetworkWrapper::kResourceOverloadNext:
-							return GetResourceField(field_type, arg1, player.GetResource());
-
-						case neural_net::NeuralNetworkWrapper::kHeroHP:
-						case neural_net::NeuralNetworkWrapper::kHeroArmor:
-							return GetHeroField(field_type, arg1, state_->GetCard(player.GetHeroRef()));
-
-						case neural_net::NeuralNetworkWrapper::kMinionCount:
-						case neural_net::NeuralNetworkWrapper::kMinionHP:
-						case neural_net::NeuralNetworkWrapper::kMinionMaxHP:
-						case neural_net::NeuralNetworkWrapper::kMinionAttack:
-						case neural_net::NeuralNetworkWrapper::kMinionAttackable:
-						case neural_net::NeuralNetworkWrapper::kMinionTaunt:
-						case neural_net::NeuralNetworkWrapper::kMinionShield:
-						case neural_net::NeuralNetworkWrapper::kMinionStealth:
-							return GetMinionsField(field_type, arg1, player.minions_);
-
-						case neural_net::NeuralNetworkWrapper::kHandCount:
-						case neural_net::NeuralNetworkWrapper::kHandPlayable:
-						case neural_net::NeuralNetworkWrapper::kHandCost:
-							return GetHandField(field_type, arg1, player.hand_);
-
-						case neural_net::NeuralNetworkWrapper::kHeroPowerPlayable:
-							return GetHeroPowerField(field_type, arg1);
-
-						default:
-							throw std::runtime_error("unknown field type");
-						}
-					}
-
-					double GetResourceField(neural_net::NeuralNetworkWrapper::FieldType field_type, int arg1, state::board::PlayerResource const& resource) {
-						switch (field_type) {
-						case neural_net::NeuralNetworkWrapper::kResourceCurrent:
-							return resource.GetCurrent();
-						case neural_net::NeuralNetworkWrapper::kResourceTotal:
-							return resource.GetTotal();
-						case neural_net::NeuralNetworkWrapper::kResourceOverload:
-							return resource.GetCurrentOverloaded();
-						case neural_net::NeuralNetworkWrapper::kResourceOverloadNext:
-							return resource.GetNextOverload();
-						default:
-							throw std::runtime_error("unknown field type");
-						}
-					}
-
-					double GetHeroField(neural_net::NeuralNetworkWrapper::FieldType field_type, int arg1, state::Cards::Card const& hero) {
-						switch (field_type) {
-						case neural_net::NeuralNetworkWrapper::kHeroHP:
-							return hero.GetHP();
-						case neural_net::NeuralNetworkWrapper::kHeroArmor:
-							return hero.GetArmor();
-						default:
-							throw std::runtime_error("unknown field type");
-						}
-					}
-
-					double GetMinionsField(neural_net::NeuralNetworkWrapper::FieldType field_type, int minion_idx, state::board::Minions const& minions) {
-						switch (field_type) {
-						case neural_net::NeuralNetworkWrapper::kMinionCount:
-							return (double)minions.Size();
-						case neural_net::NeuralNetworkWrapper::kMinionHP:
-						case neural_net::NeuralNetworkWrapper::kMinionMaxHP:
-						case neural_net::NeuralNetworkWrapper::kMinionAttack:
-						case neural_net::NeuralNetworkWrapper::kMinionAttackable:
-						case neural_net::NeuralNetworkWrapper::kMinionTaunt:
-						case neural_net::NeuralNetworkWrapper::kMinionShield:
-						case neural_net::NeuralNetworkWrapper::kMinionStealth:
-							return GetMinionField(field_type, minion_idx, state_->GetCard(minions.Get(minion_idx)));
-						default:
-							throw std::runtime_error("unknown field type");
-						}
-					}
-
-					double GetMinionField(neural_net::NeuralNetworkWrapper::FieldType field_type, int minion_idx, state::Cards::Card const& minion) {
-						switch (field_type) {
-						case neural_net::NeuralNetworkWrapper::kMinionHP:
-							return minion.GetHP();
-						case neural_net::NeuralNetworkWrapper::kMinionMaxHP:
-							return minion.GetMaxHP();
-						case neural_net::NeuralNetworkWrapper::kMinionAttack:
-							return minion.GetAttack();
-						case neural_net::NeuralNetworkWrapper::kMinionAttackable:
-							return (std::find(attackable_indics_.begin(), attackable_indics_.end(), minion_idx) != attackable_indics_.end());
-						case neural_net::NeuralNetworkWrapper::kMinionTaunt:
-							return minion.HasTaunt();
-						case neural_net::NeuralNetworkWrapper::kMinionShield:
-							return minion.HasShield();
-						case neural_net::NeuralNetworkWrapper::kMinionStealth:
-							return minion.HasStealth();
-						default:
-							throw std::runtime_error("unknown field type");
-						}
-					}
-
-					double GetHandField(neural_net::NeuralNetworkWrapper::FieldType field_type, int hand_idx, state::board::Hand const& hand) {
-						switch (field_type) {
-						case neural_net::NeuralNetworkWrapper::kHandCount:
-							return (double)hand.Size();
-						case neural_net::NeuralNetworkWrapper::kHandPlayable:
-						case neural_net::NeuralNetworkWrapper::kHandCost:
-							return GetHandCardField(field_type, hand_idx, state_->GetCard(hand.Get(hand_idx)));
-						default:
-							throw std::runtime_error("unknown field type");
-						}
-					}
-
-					double GetHandCardField(neural_net::NeuralNetworkWrapper::FieldType field_type, int hand_idx, state::Cards::Card const& card) {
-						switch (field_type) {
-						case neural_net::NeuralNetworkWrapper::kHandPlayable:
-							return (std::find(playable_cards_.begin(), playable_cards_.end(), hand_idx) != playable_cards_.end());
-						case neural_net::NeuralNetworkWrapper::kHandCost:
-							return card.GetCost();
-						default:
-							throw std::runtime_error("unknown field type");
-						}
-					}
-
-					double GetHeroPowerField(neural_net::NeuralNetworkWrapper::FieldType field_type, int arg1) {
-						switch (field_type) {
-						case neural_net::NeuralNetworkWrapper::kHeroPowerPlayable:
-							return hero_power_playable_;
-						default:
-							throw std::runtime_error("unknown field type");
-						}
-					}
-
-				private:
-					state::State const* state_;
-					std::vector<int> attackable_indics_;
-					std::vector<int> playable_cards_;
-					bool hero_power_playable_;
-				};
+				static uint64_t GetBoardHash(state::State const& state) {
+					return state.GetBoardHash(state.GetCurrentPlayerId().GetSide());
+				}
 
 			private:
 				std::string filename_;
 				neural_net::NeuralNetworkWrapper net_;
-				StateDataBridge current_player_viewer_;
+				uint64_t model_id_;
+				neural_net::StateDataBridge current_player_viewer_;
 			};
 
 			class RandomPlayoutWithHeuristicEarlyCutoffPolicy
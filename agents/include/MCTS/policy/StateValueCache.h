@@ -0,0 +1,112 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace mcts
+{
+	namespace policy
+	{
+		namespace simulation
+		{
+			// A bounded, lossy cache for state values, keyed by a model id and a 64-bit board hash
+			// Thread safety: Yes (lock-free)
+			//    Each slot stores (key ^ value) and value. A torn write by a racing thread
+			//    makes the two words inconsistent, and is then treated as a miss.
+			// The model id is derived from the network file content, so state-value functions
+			//    loading the same network share entries, and those loading different networks do not.
+			class StateValueCache
+			{
+			public:
+				static constexpr size_t kEntries = 1 << 20; // must be a power of two
+
+				static StateValueCache & GetInstance() {
+					static StateValueCache instance;
+					return instance;
+				}
+
+				StateValueCache(StateValueCache const&) = delete;
+				StateValueCache & operator=(StateValueCache const&) = delete;
+
+				// @return An id identifying the network stored in a file; zero if the file cannot be read
+				static uint64_t GetModelId(std::string const& filename) {
+					std::ifstream fs(filename, std::ios::binary);
+					if (!fs) return 0;
+
+					// FNV-1a
+					uint64_t id = 14695981039346656037ULL;
+					char buffer[4096];
+					while (fs.read(buffer, sizeof(buffer)) || fs.gcount() > 0) {
+						std::streamsize count = fs.gcount();
+						for (std::streamsize i = 0; i < count; ++i) {
+							id ^= (uint8_t)buffer[i];
+							id *= 1099511628211ULL;
+						}
+					}
+					return id;
+				}
+
+				bool Get(uint64_t model_id, uint64_t board_hash, double * value) {
+					uint64_t key = GetKey(model_id, board_hash);
+					Entry const& entry = entries_[GetIndex(key)];
+					uint64_t checked_key = entry.checked_key.load(std::memory_order_relaxed);
+					uint64_t value_bits = entry.value_bits.load(std::memory_order_relaxed);
+					if ((checked_key ^ value_bits) != key) {
+						misses_.fetch_add(1, std::memory_order_relaxed);
+						return false;
+					}
+
+					memcpy(value, &value_bits, sizeof(double));
+					hits_.fetch_add(1, std::memory_order_relaxed);
+					return true;
+				}
+
+				void Put(uint64_t model_id, uint64_t board_hash, double value) {
+					uint64_t key = GetKey(model_id, board_hash);
+					uint64_t value_bits = 0;
+					memcpy(&value_bits, &value, sizeof(double));
+
+					Entry & entry = entries_[GetIndex(key)];
+					entry.checked_key.store(key ^ value_bits, std::memory_order_relaxed);
+					entry.value_bits.store(value_bits, std::memory_order_relaxed);
+				}
+
+				uint64_t GetHits() const { return hits_.load(); }
+				uint64_t GetMisses() const { return misses_.load(); }
+
+			private:
+				struct Entry {
+					// an empty slot matches only the key 1, which is as unlikely as any other collision
+					Entry() : checked_key(1), value_bits(0) {}
+
+					std::atomic<uint64_t> checked_key;
+					std::atomic<uint64_t> value_bits;
+				};
+
+				StateValueCache() : entries_(new Entry[kEntries]), hits_(0), misses_(0) {}
+
+				static uint64_t GetKey(uint64_t model_id, uint64_t board_hash) {
+					return board_hash ^ (model_id + 0x9e3779b97f4a7c15ULL + (board_hash << 6) + (board_hash >> 2));
+				}
+
+				static size_t GetIndex(uint64_t key) {
+					// mix the bits, since the board hash is built by hash-combine
+					key ^= key >> 33;
+					key *= 0xff51afd7ed558ccdULL;
+					key ^= key >> 33;
+					return (size_t)(key & (kEntries - 1));
+				}
+
+			private:
+				std::unique_ptr<Entry[]> entries_;
+				std::atomic<uint64_t> hits_;
+				std::atomic<uint64_t> misses_;
+			};
+		}
+	}
+}
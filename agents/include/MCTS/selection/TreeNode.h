@@ -21,21 +21,21 @@ namespace mcts
 			// Note: only calls children's Get(), so a caller can acquire a read-lock only
 			class ChoiceIterator {
 			public:
-				ChoiceIterator(engine::ActionChoices & choices, ChildNodeMap & children) :
-					choices_(choices), children_(children),
+				ChoiceIterator(engine::ActionChoices const& choices, ChildNodeMap & children) :
+					choices_(choices), children_(children), idx_(0),
 					current_choice_(0), current_child_(nullptr)
 				{}
 
-				void Begin() { choices_.Begin(); }
-				void StepNext() { choices_.StepNext(); }
-				bool IsEnd() { return choices_.IsEnd(); }
+				void Begin() { idx_ = 0; }
+				void StepNext() { ++idx_; }
+				bool IsEnd() { return idx_ >= choices_.Size(); }
 
 				enum CheckResult {
 					kForceSelectChoice,
 					kNormalChoice
 				};
 				CheckResult Check() {
-					current_choice_ = choices_.Get();
+					current_choice_ = choices_.Get(idx_);
 					assert(current_choice_ >= 0);
 
 					current_child_ = children_.Get(current_choice_);
@@ -52,8 +52,9 @@ namespace mcts
 				}
 
 			private:
-				engine::ActionChoices & choices_;
+				engine::ActionChoices const& choices_;
 				ChildNodeMap & children_;
+				int idx_;
 
 				int current_choice_;
 				ChildType * current_child_;
@@ -97,7 +98,7 @@ namespace mcts
 			// Return -1 if all choices are invalid.
 			//    (or, the force_choice is invalid)
 			template <typename SelectCallback>
-			int Select(engine::ActionType action_type, engine::ActionChoices choices, SelectCallback && select_callback)
+			int Select(engine::ActionType action_type, engine::ActionChoices const& choices, SelectCallback && select_callback)
 			{
 				auto choices_type_loaded = choices_type_.load();
 				if (choices_type_loaded == engine::ActionChoices::kInvalid) {
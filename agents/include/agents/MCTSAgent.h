@@ -49,7 +49,7 @@ namespace agents
 			root_node_ = node_;
 		}
 
-		int GetAction(engine::ActionType::Types action_type, engine::ActionChoices action_choices) {
+		int GetAction(engine::ActionType::Types action_type, engine::ActionChoices const& action_choices) {
 			if (action_type != engine::ActionType::kMainAction)
 			{
 				assert(action_choices.Size() > 0);
@@ -64,10 +64,7 @@ namespace agents
 			}
 
 			auto CanBeChosen = [&](int choice) {
-				for (action_choices.Begin(); !action_choices.IsEnd(); action_choices.StepNext()) {
-					if (action_choices.Get() == choice) return true;
-				}
-				return false;
+				return action_choices.Contains(choice);
 			};
 
 			int best_choice = -1;
@@ -46,6 +46,17 @@ namespace neural_net {
 			virtual double GetField(FieldSide field_side, FieldType field_type, int arg1 = 0) = 0;
 		};
 
+		class IDataSource {
+		public:
+			virtual ~IDataSource() {}
+
+			// Starts a new pass over the data
+			virtual void Rewind() = 0;
+
+			// @return The next sample, which is valid until the next call; nullptr if this pass is over
+			virtual IInputGetter * GetNext(int * label) = 0;
+		};
+
 		NeuralNetworkWrapper() : impl_(nullptr) {}
 		~NeuralNetworkWrapper();
 
@@ -55,7 +66,13 @@ namespace neural_net {
 	public: // for training
 		void InitializeTrain();
 		void AddTrainData(IInputGetter * getter, int label, bool for_validate);
-		void Train();
+		// @param threads: number of threads to train a mini-batch in parallel; zero to use all cores
+		// @param seed: random seed for weight initialization. Fixed seed gives identical results.
+		void Train(int threads, unsigned int seed);
+
+		// Train with data streamed from data sources, so the data set needs not fit into memory
+		// Training data are consumed in chunks. The validation data is evaluated after each epoch.
+		void TrainStreaming(IDataSource * train_data, IDataSource * validate_data, int threads, unsigned int seed);
 
 	public: // for prediction
 		void InitializePredict(std::string const& filename);
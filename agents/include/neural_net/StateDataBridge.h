@@ -0,0 +1,186 @@
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "state/State.h"
+#include "engine/FlowControl/ValidActionGetter.h"
+#include "neural_net/NeuralNetwork.h"
+
+namespace neural_net {
+	// Reads the network inputs directly from a state, from the current player's point of view
+	class StateDataBridge : public NeuralNetworkWrapper::IInputGetter
+	{
+	public:
+		StateDataBridge() : state_(nullptr), attackable_indics_(),
+			playable_cards_(), hero_power_playable_()
+		{}
+
+		StateDataBridge(StateDataBridge const&) = delete;
+		StateDataBridge & operator=(StateDataBridge const&) = delete;
+
+		void Reset(state::State const& state) {
+			state_ = &state;
+
+			engine::FlowControl::ValidActionGetter valid_action(*state_);
+
+			attackable_indics_.clear();
+			valid_action.ForEachAttacker([this](int encoded_idx) {
+				attackable_indics_.push_back(encoded_idx);
+				return true;
+			});
+
+			playable_cards_.clear();
+			valid_action.ForEachPlayableCard([&](size_t idx) {
+				playable_cards_.push_back((int)idx);
+				return true;
+			});
+
+			hero_power_playable_ = valid_action.CanUseHeroPower();
+		}
+
+		double GetField(
+			NeuralNetworkWrapper::FieldSide field_side,
+			NeuralNetworkWrapper::FieldType field_type,
+			int arg1 = 0) override final
+		{
+			if (field_side == NeuralNetworkWrapper::kCurrent) {
+				return GetSideField(field_type, arg1, state_->GetCurrentPlayerId());
+			}
+			else if (field_side == NeuralNetworkWrapper::kOpponent) {
+				return GetSideField(field_type, arg1, state_->GetCurrentPlayerId().Opposite());
+			}
+			throw std::runtime_error("invalid side");
+		}
+
+	private:
+		double GetSideField(NeuralNetworkWrapper::FieldType field_type, int arg1, state::PlayerIdentifier side) {
+			state::board::Player const& player = state_->GetBoard().Get(side);
+			switch (field_type) {
+			case NeuralNetworkWrapper::kResourceCurrent:
+			case NeuralNetworkWrapper::kResourceTotal:
+			case NeuralNetworkWrapper::kResourceOverload:
+			case NeuralNetworkWrapper::kResourceOverloadNext:
+				return GetResourceField(field_type, arg1, player.GetResource());
+
+			case NeuralNetworkWrapper::kHeroHP:
+			case NeuralNetworkWrapper::kHeroArmor:
+				return GetHeroField(field_type, arg1, state_->GetCard(player.GetHeroRef()));
+
+			case NeuralNetworkWrapper::kMinionCount:
+			case NeuralNetworkWrapper::kMinionHP:
+			case NeuralNetworkWrapper::kMinionMaxHP:
+			case NeuralNetworkWrapper::kMinionAttack:
+			case NeuralNetworkWrapper::kMinionAttackable:
+			case NeuralNetworkWrapper::kMinionTaunt:
+			case NeuralNetworkWrapper::kMinionShield:
+			case NeuralNetworkWrapper::kMinionStealth:
+				return GetMinionsField(field_type, arg1, side, state_->GetCharacterStats(side));
+
+			case NeuralNetworkWrapper::kHandCount:
+			case NeuralNetworkWrapper::kHandPlayable:
+			case NeuralNetworkWrapper::kHandCost:
+				return GetHandField(field_type, arg1, player.hand_);
+
+			case NeuralNetworkWrapper::kHeroPowerPlayable:
+				return GetHeroPowerField(field_type, arg1);
+
+			default:
+				throw std::runtime_error("unknown field type");
+			}
+		}
+
+		double GetResourceField(NeuralNetworkWrapper::FieldType field_type, int arg1, state::board::PlayerResource const& resource) {
+			switch (field_type) {
+			case NeuralNetworkWrapper::kResourceCurrent:
+				return resource.GetCurrent();
+			case NeuralNetworkWrapper::kResourceTotal:
+				return resource.GetTotal();
+			case NeuralNetworkWrapper::kResourceOverload:
+				return resource.GetCurrentOverloaded();
+			case NeuralNetworkWrapper::kResourceOverloadNext:
+				return resource.GetNextOverload();
+			default:
+				throw std::runtime_error("unknown field type");
+			}
+		}
+
+		double GetHeroField(NeuralNetworkWrapper::FieldType field_type, int arg1, state::Cards::Card const& hero) {
+			switch (field_type) {
+			case NeuralNetworkWrapper::kHeroHP:
+				return hero.GetHP();
+			case NeuralNetworkWrapper::kHeroArmor:
+				return hero.GetArmor();
+			default:
+				throw std::runtime_error("unknown field type");
+			}
+		}
+
+		double GetMinionsField(NeuralNetworkWrapper::FieldType field_type, int minion_idx, state::PlayerIdentifier side, state::board::CharacterStats const& stats) {
+			if (field_type == NeuralNetworkWrapper::kMinionCount) {
+				return (double)stats.minions_count;
+			}
+
+			assert(minion_idx >= 0 && minion_idx < stats.minions_count);
+			switch (field_type) {
+			case NeuralNetworkWrapper::kMinionHP:
+				return stats.hp[minion_idx];
+			case NeuralNetworkWrapper::kMinionMaxHP:
+				return stats.max_hp[minion_idx];
+			case NeuralNetworkWrapper::kMinionAttack:
+				return stats.attack[minion_idx];
+			case NeuralNetworkWrapper::kMinionAttackable:
+				// only the current player's minions can attack, as in the recorded boards
+				if (!(side == state_->GetCurrentPlayerId())) return false;
+				return (std::find(attackable_indics_.begin(), attackable_indics_.end(), minion_idx) != attackable_indics_.end());
+			case NeuralNetworkWrapper::kMinionTaunt:
+				return stats.HasFlag(minion_idx, state::board::CharacterStats::kFlagTaunt);
+			case NeuralNetworkWrapper::kMinionShield:
+				return stats.HasFlag(minion_idx, state::board::CharacterStats::kFlagShield);
+			case NeuralNetworkWrapper::kMinionStealth:
+				return stats.HasFlag(minion_idx, state::board::CharacterStats::kFlagStealth);
+			default:
+				throw std::runtime_error("unknown field type");
+			}
+		}
+
+		double GetHandField(NeuralNetworkWrapper::FieldType field_type, int hand_idx, state::board::Hand const& hand) {
+			switch (field_type) {
+			case NeuralNetworkWrapper::kHandCount:
+				return (double)hand.Size();
+			case NeuralNetworkWrapper::kHandPlayable:
+			case NeuralNetworkWrapper::kHandCost:
+				return GetHandCardField(field_type, hand_idx, state_->GetCard(hand.Get(hand_idx)));
+			default:
+				throw std::runtime_error("unknown field type");
+			}
+		}
+
+		double GetHandCardField(NeuralNetworkWrapper::FieldType field_type, int hand_idx, state::Cards::Card const& card) {
+			switch (field_type) {
+			case NeuralNetworkWrapper::kHandPlayable:
+				return (std::find(playable_cards_.begin(), playable_cards_.end(), hand_idx) != playable_cards_.end());
+			case NeuralNetworkWrapper::kHandCost:
+				return card.GetCost();
+			default:
+				throw std::runtime_error("unknown field type");
+			}
+		}
+
+		double GetHeroPowerField(NeuralNetworkWrapper::FieldType field_type, int arg1) {
+			switch (field_type) {
+			case NeuralNetworkWrapper::kHeroPowerPlayable:
+				return hero_power_playable_;
+			default:
+				throw std::runtime_error("unknown field type");
+			}
+		}
+
+	private:
+		state::State const* state_;
+		std::vector<int> attackable_indics_;
+		std::vector<int> playable_cards_;
+		bool hero_power_playable_;
+	};
+}
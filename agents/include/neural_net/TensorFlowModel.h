@@ -0,0 +1,311 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include <cassert>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "neural_net/NeuralNetwork.h"
+
+namespace neural_net {
+	// Runs the value network trained by agents/train/tensorflow/model.py
+	// The weights are exported by agents/train/tensorflow/export.py into a versioned file:
+	//    [magic "HSTF"] [uint32 version] [uint32 tensor count]
+	//    for each tensor: [uint32 name length] [name] [uint32 rank] [uint32 dims...] [float32 data...]
+	// All integers and floats are little-endian; kernels are stored in TensorFlow's [in][out] order.
+	// Layer sizes and the number of residual blocks are taken from the tensor shapes.
+	// Card-id embeddings are not supported, since card ids are not available from IInputGetter.
+	class TensorFlowModel
+	{
+	public:
+		static constexpr char kMagic[4] = { 'H', 'S', 'T', 'F' };
+		static constexpr uint32_t kVersion = 1;
+
+		// the input layout of data_reader.py
+		static constexpr int kHeroFeatures = 1;
+		static constexpr int kMinionFeatures = 7; // exclude card id
+		static constexpr int kMinions = 7;
+		static constexpr int kHandCards = 10;
+		static constexpr int kHandCardFeatures = 1; // exclude card id
+		static constexpr int kBoardFeatures = 5; // opponent hand count, resource * 3, hero power
+
+		TensorFlowModel() :
+			hero_(), minion_(), hand_card_(), dense1_(), residual_blocks_(), final_(),
+			inputs_(), layer1_(), layer2_(), layer3_()
+		{}
+
+		static bool IsModelFile(std::string const& filename) {
+			std::ifstream fs(filename, std::ios::binary);
+			char magic[4];
+			if (!fs.read(magic, sizeof(magic))) return false;
+			return memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+		}
+
+		bool Load(std::string const& filename) {
+			std::map<std::string, Tensor> tensors;
+			if (!ReadTensors(filename, tensors)) return false;
+
+			for (auto const& item : tensors) {
+				if (item.first.find("card_embed_matrix") != std::string::npos) return false;
+			}
+
+			if (!hero_.Load(tensors, "hero1/kernel", "hero1/bias")) return false;
+			if (!minion_.Load(tensors, "minion1/kernel", "minion1/bias")) return false;
+			if (!hand_card_.Load(tensors, "hand_card_1/kernel", "hand_card_1/bias")) return false;
+			if (!dense1_.Load(tensors, "dense1/kernel", "dense1/bias")) return false;
+			if (!final_.Load(tensors, "final/kernel", "final/bias")) return false;
+
+			residual_blocks_.clear();
+			for (int idx = 1; ; ++idx) {
+				std::string prefix = "residual_" + std::to_string(idx);
+				if (tensors.find(prefix + "_1/dense/weights") == tensors.end()) break;
+
+				ResidualBlock block;
+				if (!block.dense1.Load(tensors, prefix + "_1/dense/weights", prefix + "_1/dense/biases")) return false;
+				if (!block.dense2.Load(tensors, prefix + "_2/dense/weights", prefix + "_2/dense/biases")) return false;
+				residual_blocks_.push_back(std::move(block));
+			}
+
+			if (hero_.in != kHeroFeatures) return false;
+			if (minion_.in != kMinionFeatures) return false;
+			if (hand_card_.in != kHandCardFeatures) return false;
+
+			int concat_size = 2 * hero_.out + 2 * kMinions * minion_.out +
+				1 + kHandCards * hand_card_.out + kBoardFeatures;
+			if (dense1_.in != concat_size) return false;
+
+			int hidden = dense1_.out;
+			for (auto const& block : residual_blocks_) {
+				if (block.dense1.in != hidden || block.dense1.out != hidden) return false;
+				if (block.dense2.in != hidden || block.dense2.out != hidden) return false;
+			}
+			if (final_.in != hidden || final_.out != 1) return false;
+
+			inputs_.resize(concat_size);
+			layer1_.resize(hidden);
+			layer2_.resize(hidden);
+			layer3_.resize(hidden);
+			return true;
+		}
+
+		// @return The predicted score for the current player; positive if the current player is likely to win
+		double Predict(NeuralNetworkWrapper::IInputGetter * getter) {
+			float * output = inputs_.data();
+			output = AddHero(NeuralNetworkWrapper::kCurrent, getter, output);
+			output = AddHero(NeuralNetworkWrapper::kOpponent, getter, output);
+			output = AddMinions(NeuralNetworkWrapper::kCurrent, getter, output);
+			output = AddMinions(NeuralNetworkWrapper::kOpponent, getter, output);
+			output = AddCurrentHand(getter, output);
+			output = AddBoard(getter, output);
+			assert(output == inputs_.data() + inputs_.size());
+
+			dense1_.Apply(inputs_.data(), layer1_.data(), true);
+			for (auto const& block : residual_blocks_) {
+				block.dense1.Apply(layer1_.data(), layer2_.data(), true);
+				block.dense2.Apply(layer2_.data(), layer3_.data(), true, layer1_.data());
+				layer1_.swap(layer3_);
+			}
+
+			float result = 0.0;
+			final_.Apply(layer1_.data(), &result, false);
+			return result;
+		}
+
+	private:
+		struct Tensor {
+			Tensor() : dims(), data() {}
+
+			std::vector<uint32_t> dims;
+			std::vector<float> data;
+		};
+
+		struct Dense {
+			Dense() : in(0), out(0), kernel(), bias() {}
+
+			bool Load(std::map<std::string, Tensor> const& tensors,
+				std::string const& kernel_name, std::string const& bias_name)
+			{
+				auto kernel_it = tensors.find(kernel_name);
+				auto bias_it = tensors.find(bias_name);
+				if (kernel_it == tensors.end() || bias_it == tensors.end()) return false;
+
+				Tensor const& kernel_tensor = kernel_it->second;
+				Tensor const& bias_tensor = bias_it->second;
+				if (kernel_tensor.dims.size() != 2) return false;
+				if (bias_tensor.dims.size() != 1) return false;
+				if (bias_tensor.dims[0] != kernel_tensor.dims[1]) return false;
+
+				in = (int)kernel_tensor.dims[0];
+				out = (int)kernel_tensor.dims[1];
+				kernel = kernel_tensor.data;
+				bias = bias_tensor.data;
+				return true;
+			}
+
+			// output = activation(input * kernel + bias + add)
+			void Apply(float const* input, float * output, bool relu, float const* add = nullptr) const {
+				for (int j = 0; j < out; ++j) output[j] = bias[j];
+				for (int i = 0; i < in; ++i) {
+					float v = input[i];
+					if (v == 0.0f) continue;
+					float const* row = kernel.data() + (size_t)i * out;
+					for (int j = 0; j < out; ++j) output[j] += v * row[j];
+				}
+				if (add) {
+					for (int j = 0; j < out; ++j) output[j] += add[j];
+				}
+				if (relu) {
+					for (int j = 0; j < out; ++j) {
+						if (output[j] < 0.0f) output[j] = 0.0f;
+					}
+				}
+			}
+
+			int in;
+			int out;
+			std::vector<float> kernel;
+			std::vector<float> bias;
+		};
+
+		struct ResidualBlock {
+			ResidualBlock() : dense1(), dense2() {}
+
+			Dense dense1;
+			Dense dense2;
+		};
+
+		static bool ReadTensors(std::string const& filename, std::map<std::string, Tensor> & tensors) {
+			std::ifstream fs(filename, std::ios::binary);
+			if (!fs) return false;
+
+			char magic[4];
+			uint32_t version = 0;
+			uint32_t count = 0;
+			if (!fs.read(magic, sizeof(magic))) return false;
+			if (memcmp(magic, kMagic, sizeof(kMagic)) != 0) return false;
+			if (!ReadUInt32(fs, version) || version != kVersion) return false;
+			if (!ReadUInt32(fs, count)) return false;
+
+			for (uint32_t idx = 0; idx < count; ++idx) {
+				uint32_t name_length = 0;
+				if (!ReadUInt32(fs, name_length)) return false;
+				std::string name(name_length, '\0');
+				if (!fs.read(&name[0], name_length)) return false;
+
+				Tensor tensor;
+				uint32_t rank = 0;
+				if (!ReadUInt32(fs, rank)) return false;
+				size_t size = 1;
+				for (uint32_t i = 0; i < rank; ++i) {
+					uint32_t dim = 0;
+					if (!ReadUInt32(fs, dim)) return false;
+					tensor.dims.push_back(dim);
+					size *= dim;
+				}
+
+				tensor.data.resize(size);
+				for (size_t i = 0; i < size; ++i) {
+					uint32_t bits = 0;
+					if (!ReadUInt32(fs, bits)) return false;
+					memcpy(&tensor.data[i], &bits, sizeof(float));
+				}
+
+				tensors[name] = std::move(tensor);
+			}
+			return true;
+		}
+
+		static bool ReadUInt32(std::istream & fs, uint32_t & v) {
+			unsigned char bytes[4];
+			if (!fs.read(reinterpret_cast<char*>(bytes), sizeof(bytes))) return false;
+			v = (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) |
+				((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+			return true;
+		}
+
+		static float FromBool(double v) { return v ? 1.0f : -1.0f; }
+
+		float * AddHero(
+			NeuralNetworkWrapper::FieldSide side,
+			NeuralNetworkWrapper::IInputGetter * getter,
+			float * output) const
+		{
+			float hp = (float)(getter->GetField(side, NeuralNetworkWrapper::kHeroHP) +
+				getter->GetField(side, NeuralNetworkWrapper::kHeroArmor));
+			hero_.Apply(&hp, output, true);
+			return output + hero_.out;
+		}
+
+		float * AddMinions(
+			NeuralNetworkWrapper::FieldSide side,
+			NeuralNetworkWrapper::IInputGetter * getter,
+			float * output) const
+		{
+			int count = (int)getter->GetField(side, NeuralNetworkWrapper::kMinionCount);
+			if (count > kMinions) throw std::runtime_error("too many minions");
+
+			for (int i = 0; i < kMinions; ++i) {
+				float features[kMinionFeatures] = { 0.0f, 0.0f, 0.0f, -1.0f, -1.0f, -1.0f, -1.0f };
+				if (i < count) {
+					features[0] = (float)getter->GetField(side, NeuralNetworkWrapper::kMinionHP, i);
+					features[1] = (float)getter->GetField(side, NeuralNetworkWrapper::kMinionMaxHP, i);
+					features[2] = (float)getter->GetField(side, NeuralNetworkWrapper::kMinionAttack, i);
+					features[3] = FromBool(getter->GetField(side, NeuralNetworkWrapper::kMinionAttackable, i));
+					features[4] = FromBool(getter->GetField(side, NeuralNetworkWrapper::kMinionTaunt, i));
+					features[5] = FromBool(getter->GetField(side, NeuralNetworkWrapper::kMinionShield, i));
+					features[6] = FromBool(getter->GetField(side, NeuralNetworkWrapper::kMinionStealth, i));
+				}
+				minion_.Apply(features, output, true);
+				output += minion_.out;
+			}
+			return output;
+		}
+
+		float * AddCurrentHand(NeuralNetworkWrapper::IInputGetter * getter, float * output) const {
+			int count = (int)getter->GetField(NeuralNetworkWrapper::kCurrent, NeuralNetworkWrapper::kHandCount);
+			if (count > kHandCards) throw std::runtime_error("too many hand cards");
+
+			int playable = 0;
+			for (int i = 0; i < count; ++i) {
+				if (getter->GetField(NeuralNetworkWrapper::kCurrent, NeuralNetworkWrapper::kHandPlayable, i)) ++playable;
+			}
+			*output = (float)playable;
+			++output;
+
+			for (int i = 0; i < kHandCards; ++i) {
+				float cost = -1.0f;
+				if (i < count) cost = (float)getter->GetField(NeuralNetworkWrapper::kCurrent, NeuralNetworkWrapper::kHandCost, i);
+				hand_card_.Apply(&cost, output, true);
+				output += hand_card_.out;
+			}
+			return output;
+		}
+
+		float * AddBoard(NeuralNetworkWrapper::IInputGetter * getter, float * output) const {
+			output[0] = (float)getter->GetField(NeuralNetworkWrapper::kOpponent, NeuralNetworkWrapper::kHandCount);
+			output[1] = (float)getter->GetField(NeuralNetworkWrapper::kCurrent, NeuralNetworkWrapper::kResourceCurrent);
+			output[2] = (float)getter->GetField(NeuralNetworkWrapper::kCurrent, NeuralNetworkWrapper::kResourceTotal);
+			output[3] = (float)getter->GetField(NeuralNetworkWrapper::kCurrent, NeuralNetworkWrapper::kResourceOverloadNext);
+			output[4] = FromBool(getter->GetField(NeuralNetworkWrapper::kCurrent, NeuralNetworkWrapper::kHeroPowerPlayable));
+			return output + kBoardFeatures;
+		}
+
+	private:
+		Dense hero_;
+		Dense minion_;
+		Dense hand_card_;
+		Dense dense1_;
+		std::vector<ResidualBlock> residual_blocks_;
+		Dense final_;
+
+		std::vector<float> inputs_;
+		std::vector<float> layer1_;
+		std::vector<float> layer2_;
+		std::vector<float> layer3_;
+	};
+}
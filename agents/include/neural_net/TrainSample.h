@@ -0,0 +1,157 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdexcept>
+#include <type_traits>
+
+#include "neural_net/NeuralNetwork.h"
+
+namespace neural_net {
+	// A decoded board, holding exactly the fields read by NeuralNetworkWrapper.
+	// Fixed-width and trivially copyable, so it's cheap to buffer and shuffle.
+	struct TrainSample
+	{
+		static constexpr int kMaxMinions = 7;
+		static constexpr int kMaxHandCards = 10;
+
+		enum MinionFlag : uint8_t {
+			kMinionFlagAttackable = 1 << 0,
+			kMinionFlagTaunt = 1 << 1,
+			kMinionFlagShield = 1 << 2,
+			kMinionFlagStealth = 1 << 3
+		};
+
+		struct Minion {
+			int16_t hp;
+			int16_t max_hp;
+			int16_t attack;
+			uint8_t flags;
+			uint8_t reserved;
+		};
+
+		struct HandCard {
+			int16_t cost;
+			uint8_t playable;
+			uint8_t reserved;
+		};
+
+		struct Player {
+			int16_t resource_current;
+			int16_t resource_total;
+			int16_t resource_overload;
+			int16_t resource_overload_next;
+			int16_t hero_hp;
+			int16_t hero_armor;
+			uint8_t minion_count;
+			uint8_t hand_count;
+			uint8_t hero_power_playable;
+			uint8_t reserved;
+			Minion minions[kMaxMinions];
+			HandCard hand[kMaxHandCards];
+		};
+
+		Player current;
+		Player opponent;
+		int8_t label; // 1 if current player wins; -1 otherwise
+		uint8_t turn;
+		uint8_t reserved[6]; // pad to 8-byte alignment
+
+		// Read all fields through an input getter
+		void Fill(NeuralNetworkWrapper::IInputGetter * getter, int label_value, int turn_value) {
+			FillPlayer(getter, NeuralNetworkWrapper::kCurrent, current);
+			FillPlayer(getter, NeuralNetworkWrapper::kOpponent, opponent);
+			label = (int8_t)label_value;
+			turn = (uint8_t)turn_value;
+			for (auto & v : reserved) v = 0;
+		}
+
+		class Getter : public NeuralNetworkWrapper::IInputGetter
+		{
+		public:
+			Getter() : sample_(nullptr) {}
+			Getter(TrainSample const& sample) : sample_(&sample) {}
+			Getter(Getter const&) = default;
+			Getter & operator=(Getter const&) = default;
+
+			void Reset(TrainSample const& sample) { sample_ = &sample; }
+
+			double GetField(
+				NeuralNetworkWrapper::FieldSide field_side,
+				NeuralNetworkWrapper::FieldType field_type,
+				int arg1 = 0) override final
+			{
+				Player const& player = (field_side == NeuralNetworkWrapper::kCurrent) ? sample_->current : sample_->opponent;
+
+				switch (field_type) {
+				case NeuralNetworkWrapper::kResourceCurrent: return player.resource_current;
+				case NeuralNetworkWrapper::kResourceTotal: return player.resource_total;
+				case NeuralNetworkWrapper::kResourceOverload: return player.resource_overload;
+				case NeuralNetworkWrapper::kResourceOverloadNext: return player.resource_overload_next;
+				case NeuralNetworkWrapper::kHeroHP: return player.hero_hp;
+				case NeuralNetworkWrapper::kHeroArmor: return player.hero_armor;
+				case NeuralNetworkWrapper::kMinionCount: return player.minion_count;
+				case NeuralNetworkWrapper::kMinionHP: return player.minions[arg1].hp;
+				case NeuralNetworkWrapper::kMinionMaxHP: return player.minions[arg1].max_hp;
+				case NeuralNetworkWrapper::kMinionAttack: return player.minions[arg1].attack;
+				case NeuralNetworkWrapper::kMinionAttackable: return (player.minions[arg1].flags & kMinionFlagAttackable) != 0;
+				case NeuralNetworkWrapper::kMinionTaunt: return (player.minions[arg1].flags & kMinionFlagTaunt) != 0;
+				case NeuralNetworkWrapper::kMinionShield: return (player.minions[arg1].flags & kMinionFlagShield) != 0;
+				case NeuralNetworkWrapper::kMinionStealth: return (player.minions[arg1].flags & kMinionFlagStealth) != 0;
+				case NeuralNetworkWrapper::kHandCount: return player.hand_count;
+				case NeuralNetworkWrapper::kHandPlayable: return player.hand[arg1].playable;
+				case NeuralNetworkWrapper::kHandCost: return player.hand[arg1].cost;
+				case NeuralNetworkWrapper::kHeroPowerPlayable: return player.hero_power_playable;
+				default:
+					throw std::runtime_error("unknown field type");
+				}
+			}
+
+		private:
+			TrainSample const* sample_;
+		};
+
+	private:
+		static void FillPlayer(
+			NeuralNetworkWrapper::IInputGetter * getter,
+			NeuralNetworkWrapper::FieldSide side,
+			Player & player)
+		{
+			player = Player();
+
+			player.resource_current = (int16_t)getter->GetField(side, NeuralNetworkWrapper::kResourceCurrent);
+			player.resource_total = (int16_t)getter->GetField(side, NeuralNetworkWrapper::kResourceTotal);
+			player.resource_overload = (int16_t)getter->GetField(side, NeuralNetworkWrapper::kResourceOverload);
+			player.resource_overload_next = (int16_t)getter->GetField(side, NeuralNetworkWrapper::kResourceOverloadNext);
+			player.hero_hp = (int16_t)getter->GetField(side, NeuralNetworkWrapper::kHeroHP);
+			player.hero_armor = (int16_t)getter->GetField(side, NeuralNetworkWrapper::kHeroArmor);
+
+			int minions = (int)getter->GetField(side, NeuralNetworkWrapper::kMinionCount);
+			if (minions > kMaxMinions) throw std::runtime_error("too many minions");
+			player.minion_count = (uint8_t)minions;
+			for (int i = 0; i < minions; ++i) {
+				Minion & minion = player.minions[i];
+				minion.hp = (int16_t)getter->GetField(side, NeuralNetworkWrapper::kMinionHP, i);
+				minion.max_hp = (int16_t)getter->GetField(side, NeuralNetworkWrapper::kMinionMaxHP, i);
+				minion.attack = (int16_t)getter->GetField(side, NeuralNetworkWrapper::kMinionAttack, i);
+				if (getter->GetField(side, NeuralNetworkWrapper::kMinionAttackable, i)) minion.flags |= kMinionFlagAttackable;
+				if (getter->GetField(side, NeuralNetworkWrapper::kMinionTaunt, i)) minion.flags |= kMinionFlagTaunt;
+				if (getter->GetField(side, NeuralNetworkWrapper::kMinionShield, i)) minion.flags |= kMinionFlagShield;
+				if (getter->GetField(side, NeuralNetworkWrapper::kMinionStealth, i)) minion.flags |= kMinionFlagStealth;
+			}
+
+			int hand_cards = (int)getter->GetField(side, NeuralNetworkWrapper::kHandCount);
+			if (hand_cards > kMaxHandCards) throw std::runtime_error("too many hand cards");
+			player.hand_count = (uint8_t)hand_cards;
+			if (side == NeuralNetworkWrapper::kCurrent) {
+				// only the current player's hand details are visible
+				for (int i = 0; i < hand_cards; ++i) {
+					player.hand[i].cost = (int16_t)getter->GetField(side, NeuralNetworkWrapper::kHandCost, i);
+					player.hand[i].playable = getter->GetField(side, NeuralNetworkWrapper::kHandPlayable, i) ? 1 : 0;
+				}
+				player.hero_power_playable = getter->GetField(side, NeuralNetworkWrapper::kHeroPowerPlayable) ? 1 : 0;
+			}
+		}
+	};
+	static_assert(std::is_trivially_copyable_v<TrainSample>);
+	static_assert(sizeof(TrainSample) % 8 == 0);
+}
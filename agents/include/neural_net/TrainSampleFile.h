@@ -0,0 +1,256 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "neural_net/TrainSample.h"
+
+namespace neural_net {
+	// Binary train-sample file
+	//    [Header] [TrainSample * sample_count] [GameEntry * game_count]
+	// Samples are fixed-width records, so they can be used in-place from a memory-mapped file.
+	// A game is appended by overwriting the trailing game index, and the header is updated last.
+	// Only one writer is allowed for a file at a time.
+	struct TrainSampleFile
+	{
+		static constexpr char kMagic[4] = { 'H', 'S', 'T', 'S' };
+		static constexpr uint32_t kVersion = 1;
+
+		struct Header {
+			char magic[4];
+			uint32_t version;
+			uint32_t header_size;
+			uint32_t sample_size;
+			uint64_t sample_count;
+			uint64_t game_count;
+		};
+
+		struct GameEntry {
+			uint64_t first_sample;
+			uint32_t sample_count;
+			uint8_t first_player_win;
+			uint8_t reserved[3];
+		};
+
+		static bool IsValidHeader(Header const& header) {
+			if (memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) return false;
+			if (header.version != kVersion) return false;
+			if (header.header_size != sizeof(Header)) return false;
+			if (header.sample_size != sizeof(TrainSample)) return false;
+			return true;
+		}
+
+		static uint64_t GetIndexOffset(Header const& header) {
+			return sizeof(Header) + header.sample_count * sizeof(TrainSample);
+		}
+	};
+
+	class TrainSampleFileWriter
+	{
+	public:
+		TrainSampleFileWriter() : fs_(), header_(), games_() {}
+
+		TrainSampleFileWriter(TrainSampleFileWriter const&) = delete;
+		TrainSampleFileWriter & operator=(TrainSampleFileWriter const&) = delete;
+
+		// Opens an existing file for appending, or creates a new one
+		bool Open(std::string const& filename) {
+			games_.clear();
+
+			fs_.open(filename, std::ios::in | std::ios::out | std::ios::binary);
+			if (fs_.is_open()) {
+				fs_.read(reinterpret_cast<char*>(&header_), sizeof(header_));
+				if (!fs_ || !TrainSampleFile::IsValidHeader(header_)) return false;
+
+				games_.resize(header_.game_count);
+				fs_.seekg(TrainSampleFile::GetIndexOffset(header_));
+				fs_.read(reinterpret_cast<char*>(games_.data()), games_.size() * sizeof(TrainSampleFile::GameEntry));
+				return (bool)fs_;
+			}
+
+			fs_.clear();
+			fs_.open(filename, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!fs_.is_open()) return false;
+
+			header_ = TrainSampleFile::Header();
+			memcpy(header_.magic, TrainSampleFile::kMagic, sizeof(TrainSampleFile::kMagic));
+			header_.version = TrainSampleFile::kVersion;
+			header_.header_size = sizeof(TrainSampleFile::Header);
+			header_.sample_size = sizeof(TrainSample);
+			WriteIndexAndHeader();
+			return (bool)fs_;
+		}
+
+		void AppendGame(std::vector<TrainSample> const& samples, bool first_player_win) {
+			TrainSampleFile::GameEntry game = TrainSampleFile::GameEntry();
+			game.first_sample = header_.sample_count;
+			game.sample_count = (uint32_t)samples.size();
+			game.first_player_win = first_player_win ? 1 : 0;
+
+			fs_.seekp(TrainSampleFile::GetIndexOffset(header_));
+			fs_.write(reinterpret_cast<char const*>(samples.data()), samples.size() * sizeof(TrainSample));
+
+			header_.sample_count += samples.size();
+			header_.game_count += 1;
+			games_.push_back(game);
+			WriteIndexAndHeader();
+
+			if (!fs_) throw std::runtime_error("Failed to write train samples");
+		}
+
+		uint64_t GetSampleCount() const { return header_.sample_count; }
+		uint64_t GetGameCount() const { return header_.game_count; }
+
+	private:
+		void WriteIndexAndHeader() {
+			fs_.seekp(TrainSampleFile::GetIndexOffset(header_));
+			fs_.write(reinterpret_cast<char const*>(games_.data()), games_.size() * sizeof(TrainSampleFile::GameEntry));
+			fs_.flush();
+
+			fs_.seekp(0);
+			fs_.write(reinterpret_cast<char const*>(&header_), sizeof(header_));
+			fs_.flush();
+		}
+
+	private:
+		std::fstream fs_;
+		TrainSampleFile::Header header_;
+		std::vector<TrainSampleFile::GameEntry> games_;
+	};
+
+	// Maps a train-sample file into memory; samples are accessed without copying
+	class TrainSampleFileReader
+	{
+	public:
+		TrainSampleFileReader() :
+#ifdef _MSC_VER
+			file_(INVALID_HANDLE_VALUE), mapping_(nullptr),
+#else
+			fd_(-1),
+#endif
+			data_(nullptr), size_(0), header_(nullptr), samples_(nullptr), games_(nullptr)
+		{}
+
+		TrainSampleFileReader(TrainSampleFileReader const&) = delete;
+		TrainSampleFileReader & operator=(TrainSampleFileReader const&) = delete;
+
+		~TrainSampleFileReader() { Close(); }
+
+		bool Open(std::string const& filename) {
+			Close();
+			if (!Map(filename)) {
+				Close();
+				return false;
+			}
+
+			if (size_ < sizeof(TrainSampleFile::Header)) return Fail();
+			header_ = reinterpret_cast<TrainSampleFile::Header const*>(data_);
+			if (!TrainSampleFile::IsValidHeader(*header_)) return Fail();
+
+			uint64_t index_offset = TrainSampleFile::GetIndexOffset(*header_);
+			uint64_t expected_size = index_offset + header_->game_count * sizeof(TrainSampleFile::GameEntry);
+			if (size_ < expected_size) return Fail();
+
+			samples_ = reinterpret_cast<TrainSample const*>(data_ + sizeof(TrainSampleFile::Header));
+			games_ = reinterpret_cast<TrainSampleFile::GameEntry const*>(data_ + index_offset);
+			return true;
+		}
+
+		size_t GetSampleCount() const { return (size_t)header_->sample_count; }
+		TrainSample const& GetSample(size_t idx) const { return samples_[idx]; }
+
+		size_t GetGameCount() const { return (size_t)header_->game_count; }
+		TrainSampleFile::GameEntry const& GetGame(size_t idx) const { return games_[idx]; }
+
+	private:
+		bool Fail() {
+			Close();
+			return false;
+		}
+
+#ifdef _MSC_VER
+		bool Map(std::string const& filename) {
+			file_ = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+				OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (file_ == INVALID_HANDLE_VALUE) return false;
+
+			LARGE_INTEGER size;
+			if (!GetFileSizeEx(file_, &size)) return false;
+			size_ = (size_t)size.QuadPart;
+			if (size_ == 0) return false;
+
+			mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (!mapping_) return false;
+
+			data_ = static_cast<char const*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+			return data_ != nullptr;
+		}
+
+		void Close() {
+			if (data_) UnmapViewOfFile(data_);
+			if (mapping_) CloseHandle(mapping_);
+			if (file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+			file_ = INVALID_HANDLE_VALUE;
+			mapping_ = nullptr;
+			Reset();
+		}
+#else
+		bool Map(std::string const& filename) {
+			fd_ = open(filename.c_str(), O_RDONLY);
+			if (fd_ < 0) return false;
+
+			struct stat st;
+			if (fstat(fd_, &st) != 0) return false;
+			size_ = (size_t)st.st_size;
+			if (size_ == 0) return false;
+
+			void * addr = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd_, 0);
+			if (addr == MAP_FAILED) return false;
+			data_ = static_cast<char const*>(addr);
+			return true;
+		}
+
+		void Close() {
+			if (data_) munmap(const_cast<char*>(data_), size_);
+			if (fd_ >= 0) close(fd_);
+			fd_ = -1;
+			Reset();
+		}
+#endif
+
+		void Reset() {
+			data_ = nullptr;
+			size_ = 0;
+			header_ = nullptr;
+			samples_ = nullptr;
+			games_ = nullptr;
+		}
+
+	private:
+#ifdef _MSC_VER
+		HANDLE file_;
+		HANDLE mapping_;
+#else
+		int fd_;
+#endif
+		char const* data_;
+		size_t size_;
+		TrainSampleFile::Header const* header_;
+		TrainSample const* samples_;
+		TrainSampleFile::GameEntry const* games_;
+	};
+}
@@ -3,7 +3,10 @@
 #pragma warning (disable: 4083 4244 4267)
 #endif
 
-#define CNN_SINGLE_THREAD
+// Do not define CNN_SINGLE_THREAD: tiny_dnn then splits each mini-batch across worker threads.
+// Every thread back-propagates its own samples into per-sample gradient buffers, and the
+// buffers are reduced in sample order before the weight update. So, the result is the same
+// regardless of how many threads are used.
 
 #ifdef _MSC_VER
 #define CNN_USE_SSE
@@ -13,14 +16,36 @@
 #include <chrono> // workaround tiny_dnn issue #872
 #include "tiny_dnn/tiny_dnn.h"
 
+#include <iomanip>
+#include <thread>
+
 #ifdef _MSC_VER
 #pragma warning (pop)
 #endif
 
 #include "neural_net/NeuralNetwork.h"
+#include "neural_net/TensorFlowModel.h"
 
 namespace neural_net {
 	namespace impl {
+		// tiny_dnn's fit() resets the optimizer on every call
+		// This one resets only on the first call, so the moment estimates are kept across calls,
+		//    as if all the calls were a single fit() over the concatenated data.
+		class ContinuedAdam : public tiny_dnn::adam
+		{
+		public:
+			ContinuedAdam() : started_(false) {}
+
+			void reset() override {
+				if (started_) return;
+				tiny_dnn::adam::reset();
+				started_ = true;
+			}
+
+		private:
+			bool started_;
+		};
+
 		class NeuralNetworkWrapperImpl
 		{
 		public:
@@ -44,7 +69,138 @@ namespace neural_net {
 				}
 			}
 
-			void Train() {
+			void Train(int threads, unsigned int seed) {
+				threads = GetTrainThreads(threads);
+
+				BuildNetworkAndRun(seed, [&]() {
+					size_t batch_size = 32;
+					int epoch = 10;
+					size_t total_epoch = 0;
+					tiny_dnn::adam opt;
+
+					std::cout << "Training with " << threads << " threads, seed " << seed << std::endl;
+
+					while (true) {
+						int batch_op_counter = 0;
+						auto batch_op = [batch_op_counter]() mutable {
+							++batch_op_counter;
+							if (batch_op_counter % 10000 == 0) {
+								std::cout << "completed batches: " << batch_op_counter << std::endl;
+							}
+						};
+
+						auto epoch_start = std::chrono::steady_clock::now();
+						auto epoch_op = [&]() {
+							++total_epoch;
+							auto epoch_end = std::chrono::steady_clock::now();
+							double epoch_seconds = std::chrono::duration<double>(epoch_end - epoch_start).count();
+
+							double train_rate = GetCorrectRate(input_, output_);
+							double validate_rate = GetCorrectRate(validate_input_, validate_output_);
+
+							std::cout << "completed epoch: " << total_epoch
+								<< std::fixed << std::setprecision(2)
+								<< "\ttime: " << epoch_seconds << "s"
+								<< "\ttest data correct rate: " << train_rate * 100.0 << "%"
+								<< "\tvalidation correct rate: " << validate_rate * 100.0 << "%"
+								<< std::defaultfloat << std::endl;
+
+							// do not count the evaluation above in the next epoch
+							epoch_start = std::chrono::steady_clock::now();
+						};
+						net_.fit<tiny_dnn::mse>(opt, input_, output_, batch_size, epoch, batch_op, epoch_op, false, threads);
+
+						std::stringstream ss;
+						ss << "net_result_epoch_" << total_epoch;
+						net_.save(ss.str());
+					}
+				});
+			}
+
+			void TrainStreaming(
+				NeuralNetworkWrapper::IDataSource * train_data,
+				NeuralNetworkWrapper::IDataSource * validate_data,
+				int threads, unsigned int seed)
+			{
+				threads = GetTrainThreads(threads);
+
+				BuildNetworkAndRun(seed, [&]() {
+					size_t batch_size = 32;
+
+					// samples are converted to tensors a chunk at a time
+					// the optimizer state is kept across chunks and epochs (see ContinuedAdam)
+					size_t chunk_size = batch_size * 4096;
+
+					size_t total_epoch = 0;
+					ContinuedAdam opt;
+
+					std::cout << "Streaming training with " << threads << " threads, seed " << seed << std::endl;
+
+					std::vector<tiny_dnn::tensor_t> chunk_input;
+					std::vector<tiny_dnn::vec_t> chunk_output;
+					chunk_input.reserve(chunk_size);
+					chunk_output.reserve(chunk_size);
+
+					while (true) {
+						auto epoch_start = std::chrono::steady_clock::now();
+						size_t total_samples = 0;
+
+						train_data->Rewind();
+						bool has_more = true;
+						while (has_more) {
+							chunk_input.clear();
+							chunk_output.clear();
+							while (chunk_input.size() < chunk_size) {
+								int label = 0;
+								NeuralNetworkWrapper::IInputGetter * getter = train_data->GetNext(&label);
+								if (!getter) {
+									has_more = false;
+									break;
+								}
+								chunk_input.emplace_back();
+								GetInputData(getter, chunk_input.back());
+								chunk_output.push_back({ (float)label });
+							}
+							if (chunk_input.empty()) break;
+
+							net_.fit<tiny_dnn::mse>(opt, chunk_input, chunk_output, batch_size, 1, []() {}, []() {}, false, threads);
+							total_samples += chunk_input.size();
+						}
+						if (total_samples == 0) throw std::runtime_error("no training data");
+
+						++total_epoch;
+						auto epoch_end = std::chrono::steady_clock::now();
+						double epoch_seconds = std::chrono::duration<double>(epoch_end - epoch_start).count();
+
+						double validate_rate = GetCorrectRate(validate_data);
+
+						std::cout << "completed epoch: " << total_epoch
+							<< std::fixed << std::setprecision(2)
+							<< "\ttime: " << epoch_seconds << "s"
+							<< "\tsamples: " << total_samples
+							<< "\tvalidation correct rate: " << validate_rate * 100.0 << "%"
+							<< std::defaultfloat << std::endl;
+
+						std::stringstream ss;
+						ss << "net_result_epoch_" << total_epoch;
+						net_.save(ss.str());
+					}
+				});
+			}
+
+		private:
+			int GetTrainThreads(int threads) {
+				if (threads <= 0) threads = (int)std::thread::hardware_concurrency();
+				if (threads <= 0) threads = 1;
+				return threads;
+			}
+
+			// The layers are referenced by the graph network, so they only live during the callback
+			template <class Functor>
+			void BuildNetworkAndRun(unsigned int seed, Functor && functor) {
+				// weights are initialized from tiny_dnn's global random engine
+				tiny_dnn::set_random_seed(seed);
+
 				static constexpr int hero_in_dim = 1;
 				static constexpr int hero_out_dim = 1;
 
@@ -99,68 +255,68 @@ namespace neural_net {
 
 				tiny_dnn::construct_graph(net_, { &in_heroes, &in_minions, &in_standalone }, { &fc2 });
 
-				size_t batch_size = 32;
-				int epoch = 10;
-				size_t total_epoch = 0;
-				tiny_dnn::adam opt;
-
-				while (true) {
-					int batch_op_counter = 0;
-					auto batch_op = [batch_op_counter]() mutable {
-						++batch_op_counter;
-						if (batch_op_counter % 10000 == 0) {
-							std::cout << "completed batches: " << batch_op_counter << std::endl;
-						}
-					};
-
-					auto epoch_op = [&total_epoch]() mutable {
-						++total_epoch;
-						std::cout << "completed epoch: " << total_epoch << std::endl;
-					};
-					net_.fit<tiny_dnn::mse>(opt, input_, output_, batch_size, epoch, batch_op, epoch_op);
-
-					std::stringstream ss;
-					ss << "net_result_epoch_" << total_epoch;
-					net_.save(ss.str());
-
-					size_t correct = 0;
+				functor();
+			}
 
-					for (size_t idx = 0; idx < input_.size(); ++idx) {
-						auto result = net_.predict(input_[idx]);
-						bool predict_win = (result[0][0] > 0.0);
-						bool actual_win = (output_[idx][0] > 0.0);
-						if (predict_win == actual_win) ++correct;
-					}
-					double rate = ((double)correct) / input_.size();
-					std::cout << "test data correct rate: "
-						<< rate * 100.0 << "% ("
-						<< correct << " / " << input_.size() << ")" << std::endl;
-
-					correct = 0;
-					for (size_t idx = 0; idx < validate_input_.size(); ++idx) {
-						auto result = net_.predict(validate_input_[idx]);
-						bool predict_win = (result[0][0] > 0.0);
-						bool actual_win = (validate_output_[idx][0] > 0.0);
-						if (predict_win == actual_win) ++correct;
+		public:
+			void InitializePredict(std::string const& filename) {
+				if (TensorFlowModel::IsModelFile(filename)) {
+					tf_model_.reset(new TensorFlowModel());
+					if (!tf_model_->Load(filename)) {
+						throw std::runtime_error("Failed to load TensorFlow model: " + filename);
 					}
-					rate = ((double)correct) / validate_input_.size();
-					std::cout << "validation correct rate: "
-						<< rate * 100.0 << "% ("
-						<< correct << " / " << validate_input_.size() << ")" << std::endl;
+					return;
 				}
-			}
 
-			void InitializePredict(std::string const& filename) {
+				tf_model_.reset();
 				net_.load(filename);
 			}
 
 			double Predict(NeuralNetworkWrapper::IInputGetter * getter) {
+				if (tf_model_) return tf_model_->Predict(getter);
+
 				tiny_dnn::tensor_t input;
 				GetInputData(getter, input);
 				return net_.predict(input)[0][0];
 			}
 
 		private:
+			double GetCorrectRate(NeuralNetworkWrapper::IDataSource * data) {
+				size_t total = 0;
+				size_t correct = 0;
+
+				data->Rewind();
+				while (true) {
+					int label = 0;
+					NeuralNetworkWrapper::IInputGetter * getter = data->GetNext(&label);
+					if (!getter) break;
+
+					tiny_dnn::tensor_t input;
+					GetInputData(getter, input);
+					auto result = net_.predict(input);
+					bool predict_win = (result[0][0] > 0.0);
+					bool actual_win = (label > 0);
+					if (predict_win == actual_win) ++correct;
+					++total;
+				}
+
+				if (total == 0) return 0.0;
+				return ((double)correct) / total;
+			}
+
+			double GetCorrectRate(std::vector<tiny_dnn::tensor_t> const& input, std::vector<tiny_dnn::vec_t> const& output) {
+				if (input.empty()) return 0.0;
+
+				size_t correct = 0;
+				for (size_t idx = 0; idx < input.size(); ++idx) {
+					auto result = net_.predict(input[idx]);
+					bool predict_win = (result[0][0] > 0.0);
+					bool actual_win = (output[idx][0] > 0.0);
+					if (predict_win == actual_win) ++correct;
+				}
+				return ((double)correct) / input.size();
+			}
+
 			void GetInputData(NeuralNetworkWrapper::IInputGetter * getter, tiny_dnn::tensor_t & data) {
 				tiny_dnn::vec_t input1;
 				AddHeroData(NeuralNetworkWrapper::kCurrent, getter, input1);
@@ -302,6 +458,7 @@ namespace neural_net {
 			std::vector<tiny_dnn::tensor_t> validate_input_;
 			std::vector<tiny_dnn::vec_t> validate_output_;
 			tiny_dnn::network<tiny_dnn::graph> net_;
+			std::unique_ptr<TensorFlowModel> tf_model_;
 		};
 	}
 
@@ -321,9 +478,14 @@ namespace neural_net {
 		impl_->AddTrainData(getter, label, for_validate);
 	}
 
-	void NeuralNetworkWrapper::Train()
+	void NeuralNetworkWrapper::Train(int threads, unsigned int seed)
+	{
+		impl_->Train(threads, seed);
+	}
+
+	void NeuralNetworkWrapper::TrainStreaming(IDataSource * train_data, IDataSource * validate_data, int threads, unsigned int seed)
 	{
-		impl_->Train();
+		impl_->TrainStreaming(train_data, validate_data, threads, seed);
 	}
 
 	void NeuralNetworkWrapper::InitializePredict(std::string const& filename)
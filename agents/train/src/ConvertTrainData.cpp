@@ -0,0 +1,64 @@
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "neural_net/TrainSample.h"
+#include "neural_net/TrainSampleFile.h"
+#include "JsonGameDecoder.h"
+
+// Converts recorded JSON games to a binary train-sample file
+int main(int argc, char **argv)
+{
+	if (argc != 3) {
+		std::cout << "Usage: (program) (dirname) (output file)" << std::endl;
+		std::cout << "\tGames listed in (dirname)/filelist are appended to the output file" << std::endl;
+		return -1;
+	}
+
+	std::string dirname = argv[1];
+	std::string output_path = argv[2];
+	std::string filelist_path = dirname + "/filelist";
+
+	std::cout << "Reading from dir: " << dirname << std::endl;
+	std::cout << "Filelist file: " << filelist_path << std::endl;
+	std::cout << "Output file: " << output_path << std::endl;
+
+	neural_net::TrainSampleFileWriter writer;
+	if (!writer.Open(output_path)) {
+		std::cout << "Failed to open output file " << output_path << std::endl;
+		return -1;
+	}
+
+	std::ifstream filelist(filelist_path);
+
+	int converted_files = 0;
+	std::vector<neural_net::TrainSample> samples;
+	while (filelist) {
+		std::string filename;
+		filelist >> filename;
+		if (filename.empty()) continue;
+
+		samples.clear();
+		bool first_player_win = false;
+		try {
+			first_player_win = JsonGameDecoder()(dirname + "/" + filename, samples);
+		}
+		catch (...) {
+			std::cout << "Failed when loading file " << filename << std::endl;
+			throw;
+		}
+		writer.AppendGame(samples, first_player_win);
+
+		++converted_files;
+		if (converted_files % 100 == 0) {
+			std::cout << "Converted " << converted_files << " files" << std::endl;
+		}
+	}
+
+	std::cout << "Done. Games: " << writer.GetGameCount()
+		<< ", samples: " << writer.GetSampleCount() << std::endl;
+
+	return 0;
+}
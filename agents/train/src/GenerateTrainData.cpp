@@ -11,6 +11,7 @@
 #include "TestStateBuilder.h"
 #include "judge/Judger.h"
 #include "agents/MCTSAgent.h"
+#include "TrainSampleRecorder.h"
 
 static void Initialize(unsigned int rand_seed)
 {
@@ -108,7 +109,7 @@ int main(int argc, char *argv[])
 
 	using MCTSAgent = agents::MCTSAgent<IterationCallback>;
 
-	judge::Judger<MCTSAgent> judger(rand);
+	judge::Judger<MCTSAgent, TrainSampleRecorder> judger(rand);
 	constexpr int root_samples = 10;
 
 	IterationCallback iteration_cb;
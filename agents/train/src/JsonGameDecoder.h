@@ -0,0 +1,207 @@
+#pragma once
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "json/json.h"
+
+#include "neural_net/NeuralNetwork.h"
+#include "neural_net/TrainSample.h"
+
+using neural_net::NeuralNetworkWrapper;
+
+class JsonDataParser : public NeuralNetworkWrapper::IInputGetter
+{
+public:
+	JsonDataParser(Json::Value const& obj) : obj_(obj) {
+	}
+
+	double GetField(
+		NeuralNetworkWrapper::FieldSide field_side,
+		NeuralNetworkWrapper::FieldType field_type,
+		int arg1 = 0) override final
+	{
+		if (field_side == NeuralNetworkWrapper::kCurrent) {
+			return GetSideField(field_type, arg1, obj_["current_player"]);
+		}
+		else if (field_side == NeuralNetworkWrapper::kOpponent) {
+			return GetSideField(field_type, arg1, obj_["opponent_player"]);
+		}
+		throw std::runtime_error("invalid side");
+	}
+
+private:
+	double GetSideField(NeuralNetworkWrapper::FieldType field_type, int arg1, Json::Value const& side) {
+		switch (field_type) {
+		case NeuralNetworkWrapper::kResourceCurrent:
+		case NeuralNetworkWrapper::kResourceTotal:
+		case NeuralNetworkWrapper::kResourceOverload:
+		case NeuralNetworkWrapper::kResourceOverloadNext:
+			return GetResourceField(field_type, arg1, side["resource"]);
+
+		case NeuralNetworkWrapper::kHeroHP:
+		case NeuralNetworkWrapper::kHeroArmor:
+			return GetHeroField(field_type, arg1, side["hero"]);
+
+		case NeuralNetworkWrapper::kMinionCount:
+		case NeuralNetworkWrapper::kMinionHP:
+		case NeuralNetworkWrapper::kMinionMaxHP:
+		case NeuralNetworkWrapper::kMinionAttack:
+		case NeuralNetworkWrapper::kMinionAttackable:
+		case NeuralNetworkWrapper::kMinionTaunt:
+		case NeuralNetworkWrapper::kMinionShield:
+		case NeuralNetworkWrapper::kMinionStealth:
+			return GetMinionsField(field_type, arg1, side["minions"]);
+
+		case NeuralNetworkWrapper::kHandCount:
+		case NeuralNetworkWrapper::kHandPlayable:
+		case NeuralNetworkWrapper::kHandCost:
+			return GetHandField(field_type, arg1, side["hand"]);
+
+		case NeuralNetworkWrapper::kHeroPowerPlayable:
+			return GetHeroPowerField(field_type, arg1, side["hero_power"]);
+
+		default:
+			throw std::runtime_error("unknown field type");
+		}
+	}
+
+	double GetResourceField(NeuralNetworkWrapper::FieldType field_type, int arg1, Json::Value const& resource) {
+		switch (field_type) {
+		case NeuralNetworkWrapper::kResourceCurrent:
+			return resource["current"].asInt();
+		case NeuralNetworkWrapper::kResourceTotal:
+			return resource["total"].asInt();
+		case NeuralNetworkWrapper::kResourceOverload:
+			return resource["overload_current"].asInt();
+		case NeuralNetworkWrapper::kResourceOverloadNext:
+			return resource["overload_next"].asInt();
+		default:
+			throw std::runtime_error("unknown field type");
+		}
+	}
+
+	double GetHeroField(NeuralNetworkWrapper::FieldType field_type, int arg1, Json::Value const& hero) {
+		switch (field_type) {
+		case NeuralNetworkWrapper::kHeroHP:
+			return hero["hp"].asInt();
+		case NeuralNetworkWrapper::kHeroArmor:
+			return hero["armor"].asInt();
+		default:
+			throw std::runtime_error("unknown field type");
+		}
+	}
+
+	double GetMinionsField(NeuralNetworkWrapper::FieldType field_type, int minion_idx, Json::Value const& minions) {
+		switch (field_type) {
+		case NeuralNetworkWrapper::kMinionCount:
+			return minions.size();
+		case NeuralNetworkWrapper::kMinionHP:
+			return minions[minion_idx]["hp"].asInt();
+		case NeuralNetworkWrapper::kMinionMaxHP:
+			return minions[minion_idx]["max_hp"].asInt();
+		case NeuralNetworkWrapper::kMinionAttack:
+			return minions[minion_idx]["attack"].asInt();
+		case NeuralNetworkWrapper::kMinionAttackable:
+			return minions[minion_idx]["attackable"].asBool();
+		case NeuralNetworkWrapper::kMinionTaunt:
+			return minions[minion_idx]["taunt"].asBool();
+		case NeuralNetworkWrapper::kMinionShield:
+			return minions[minion_idx]["shield"].asBool();
+		case NeuralNetworkWrapper::kMinionStealth:
+			return minions[minion_idx]["stealth"].asBool();
+		default:
+			throw std::runtime_error("unknown field type");
+		}
+	}
+
+	double GetHandField(NeuralNetworkWrapper::FieldType field_type, int hand_idx, Json::Value const& hand) {
+		switch (field_type) {
+		case NeuralNetworkWrapper::kHandCount:
+			return hand.size();
+		case NeuralNetworkWrapper::kHandPlayable:
+			return hand[hand_idx]["playable"].asBool();
+		case NeuralNetworkWrapper::kHandCost:
+			return hand[hand_idx]["cost"].asInt();
+		default:
+			throw std::runtime_error("unknown field type");
+		}
+	}
+
+	double GetHeroPowerField(NeuralNetworkWrapper::FieldType field_type, int arg1, Json::Value const& hero_power) {
+		switch (field_type) {
+		case NeuralNetworkWrapper::kHeroPowerPlayable:
+			return hero_power["playable"].asBool();
+		default:
+			throw std::runtime_error("unknown field type");
+		}
+	}
+
+private:
+	Json::Value const& obj_;
+};
+
+class JsonGameDecoder
+{
+public:
+	// Decode the main-action boards of one recorded game
+	// @return true if the first player wins
+	bool operator()(std::string const& filename, std::vector<neural_net::TrainSample> & samples) const {
+		Json::Value obj;
+		Json::Reader reader;
+		std::ifstream fs(filename);
+		if (!reader.parse(fs, obj)) {
+			throw std::runtime_error("Failed when loading file " + filename);
+		}
+
+		std::string result = GetResult(obj);
+		for (Json::ArrayIndex idx = 0; idx < obj.size(); ++idx) {
+			if (obj[idx]["type"].asString() == "kMainAction") {
+				Json::Value const& board = obj[idx]["board"];
+
+				int turn = board["turn"].asInt();
+
+				JsonDataParser board_parser(board);
+				int label = IsCurrentPlayerWin(board, result) ? 1 : -1;
+
+				samples.emplace_back();
+				samples.back().Fill(&board_parser, label, turn);
+			}
+		}
+
+		return IsResultWin(result);
+	}
+
+private:
+	std::string GetResult(Json::Value const& obj) const {
+		for (Json::ArrayIndex idx = 0; idx < obj.size(); ++idx) {
+			if (obj[idx]["type"].asString() == "kEnd") {
+				return obj[idx]["result"].asString();
+			}
+		}
+		throw std::runtime_error("Cannot find win player");
+	}
+
+	bool IsResultWin(std::string const& win_player) const {
+		if (win_player == "kResultFirstPlayerWin") return true;
+		if (win_player == "kResultSecondPlayerWin") return false;
+		if (win_player == "kResultDraw") return false;
+		throw std::runtime_error("Failed to parse winning player");
+	}
+
+	bool IsCurrentPlayerWin(Json::Value const& board, std::string const& result) const {
+		std::string current_player = board["current_player_id"].asString();
+
+		bool current_player_is_first = false;
+		if (current_player == "kFirstPlayer") current_player_is_first = true;
+		else if (current_player == "kSecondPlayer") current_player_is_first = false;
+		else throw std::runtime_error("Failed to parse current player");
+
+		// Note: AI is always helping first player
+		bool win_player_is_first = IsResultWin(result);
+
+		return current_player_is_first == win_player_is_first;
+	}
+};
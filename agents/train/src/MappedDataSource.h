@@ -0,0 +1,77 @@
+#pragma once
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "neural_net/NeuralNetwork.h"
+#include "neural_net/TrainSample.h"
+#include "neural_net/TrainSampleFile.h"
+
+// Reads train samples in-place from memory-mapped train-sample files
+//    * Games are visited in a shuffled order in each pass.
+//    * Samples are picked randomly from a window of sample pointers; no sample is copied.
+class MappedDataSource : public neural_net::NeuralNetworkWrapper::IDataSource
+{
+public:
+	MappedDataSource(size_t shuffle_window_size, int min_turn, unsigned int seed) :
+		shuffle_window_size_(std::max(shuffle_window_size, (size_t)1)),
+		min_turn_(min_turn), rand_(seed),
+		games_(), next_game_(0), window_(), getter_()
+	{}
+
+	void AddGame(neural_net::TrainSampleFileReader const& file, size_t game_idx) {
+		games_.push_back({ &file, game_idx });
+	}
+
+	size_t GetGameCount() const { return games_.size(); }
+
+	void Rewind() override final {
+		std::shuffle(games_.begin(), games_.end(), rand_);
+		next_game_ = 0;
+		window_.clear();
+	}
+
+	neural_net::NeuralNetworkWrapper::IInputGetter * GetNext(int * label) override final {
+		while (window_.size() < shuffle_window_size_) {
+			if (next_game_ >= games_.size()) break;
+			AddGameToWindow(games_[next_game_]);
+			++next_game_;
+		}
+		if (window_.empty()) return nullptr;
+
+		size_t idx = rand_() % window_.size();
+		neural_net::TrainSample const* sample = window_[idx];
+		window_[idx] = window_.back();
+		window_.pop_back();
+
+		*label = sample->label;
+		getter_.Reset(*sample);
+		return &getter_;
+	}
+
+private:
+	struct GameRef {
+		neural_net::TrainSampleFileReader const* file;
+		size_t game_idx;
+	};
+
+	void AddGameToWindow(GameRef const& game_ref) {
+		auto const& game = game_ref.file->GetGame(game_ref.game_idx);
+		for (uint32_t i = 0; i < game.sample_count; ++i) {
+			neural_net::TrainSample const& sample = game_ref.file->GetSample((size_t)(game.first_sample + i));
+			if (sample.turn < min_turn_) continue;
+			window_.push_back(&sample);
+		}
+	}
+
+private:
+	size_t shuffle_window_size_;
+	int min_turn_;
+	std::mt19937 rand_;
+
+	std::vector<GameRef> games_;
+	size_t next_game_;
+	std::vector<neural_net::TrainSample const*> window_;
+	neural_net::TrainSample::Getter getter_;
+};
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "neural_net/NeuralNetwork.h"
+#include "neural_net/TrainSample.h"
+
+// Streams train samples from a list of shards, without loading all of them into memory.
+//    * Shards are decoded by background threads, at most 'prefetch_shards' ahead of the consumer.
+//    * Decoded shards are consumed in shard order, so a fixed seed gives a fixed sample order
+//      regardless of the number of threads.
+//    * Samples are passed through a shuffle buffer before they are returned.
+class StreamingDataReader : public neural_net::NeuralNetworkWrapper::IDataSource
+{
+public:
+	using Decoder = std::function<void(std::string const& shard, std::vector<neural_net::TrainSample> & samples)>;
+
+	StreamingDataReader(
+		std::vector<std::string> shards, Decoder decoder,
+		int threads, size_t prefetch_shards, size_t shuffle_buffer_size, unsigned int seed) :
+		shards_(std::move(shards)), decoder_(std::move(decoder)),
+		threads_(std::max(threads, 1)),
+		prefetch_shards_(std::max(prefetch_shards, (size_t)1)),
+		shuffle_buffer_size_(std::max(shuffle_buffer_size, (size_t)1)),
+		rand_(seed),
+		mutex_(), cv_(), workers_(), stopping_(false),
+		next_claim_(0), next_consume_(0), ready_(),
+		current_(), current_pos_(0), buffer_(),
+		sample_(), getter_(sample_)
+	{}
+
+	StreamingDataReader(StreamingDataReader const&) = delete;
+	StreamingDataReader & operator=(StreamingDataReader const&) = delete;
+
+	~StreamingDataReader() { Stop(); }
+
+	void Rewind() override final {
+		Stop();
+
+		std::shuffle(shards_.begin(), shards_.end(), rand_);
+		stopping_ = false;
+		next_claim_ = 0;
+		next_consume_ = 0;
+		ready_.clear();
+		current_.clear();
+		current_pos_ = 0;
+		buffer_.clear();
+
+		for (int i = 0; i < threads_; ++i) {
+			workers_.emplace_back([this]() { WorkerLoop(); });
+		}
+	}
+
+	neural_net::NeuralNetworkWrapper::IInputGetter * GetNext(int * label) override final {
+		while (buffer_.size() < shuffle_buffer_size_) {
+			if (current_pos_ >= current_.size()) {
+				if (!FetchNextShard()) break;
+				continue;
+			}
+			buffer_.push_back(current_[current_pos_]);
+			++current_pos_;
+		}
+		if (buffer_.empty()) return nullptr;
+
+		size_t idx = rand_() % buffer_.size();
+		sample_ = buffer_[idx];
+		buffer_[idx] = buffer_.back();
+		buffer_.pop_back();
+
+		*label = sample_.label;
+		return &getter_;
+	}
+
+private:
+	struct DecodedShard {
+		DecodedShard() : samples(), error() {}
+
+		std::vector<neural_net::TrainSample> samples;
+		std::exception_ptr error;
+	};
+
+	bool FetchNextShard() {
+		if (next_consume_ >= shards_.size()) return false;
+
+		DecodedShard shard;
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			cv_.wait(lock, [&]() { return ready_.find(next_consume_) != ready_.end(); });
+			auto it = ready_.find(next_consume_);
+			shard = std::move(it->second);
+			ready_.erase(it);
+			++next_consume_;
+		}
+		cv_.notify_all(); // a prefetch slot is available
+
+		if (shard.error) std::rethrow_exception(shard.error);
+
+		current_ = std::move(shard.samples);
+		current_pos_ = 0;
+		return true;
+	}
+
+	void WorkerLoop() {
+		while (true) {
+			size_t idx = 0;
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				cv_.wait(lock, [&]() {
+					return stopping_ || next_claim_ < next_consume_ + prefetch_shards_;
+				});
+				if (stopping_) return;
+				if (next_claim_ >= shards_.size()) return;
+				idx = next_claim_;
+				++next_claim_;
+			}
+
+			DecodedShard shard;
+			try {
+				decoder_(shards_[idx], shard.samples);
+			}
+			catch (...) {
+				shard.error = std::current_exception();
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				ready_[idx] = std::move(shard);
+			}
+			cv_.notify_all();
+		}
+	}
+
+	void Stop() {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stopping_ = true;
+		}
+		cv_.notify_all();
+
+		for (auto & worker : workers_) worker.join();
+		workers_.clear();
+	}
+
+private:
+	std::vector<std::string> shards_;
+	Decoder decoder_;
+	int threads_;
+	size_t prefetch_shards_;
+	size_t shuffle_buffer_size_;
+	std::mt19937 rand_;
+
+	std::mutex mutex_;
+	std::condition_variable cv_;
+	std::vector<std::thread> workers_;
+	bool stopping_;
+	size_t next_claim_;
+	size_t next_consume_;
+	std::map<size_t, DecodedShard> ready_;
+
+	std::vector<neural_net::TrainSample> current_;
+	size_t current_pos_;
+	std::vector<neural_net::TrainSample> buffer_;
+
+	neural_net::TrainSample sample_;
+	neural_net::TrainSample::Getter getter_;
+};
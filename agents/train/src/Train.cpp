@@ -1,229 +1,148 @@
+#include <algorithm>
 #include <exception>
 #include <fstream>
 #include <iostream>
 #include <cmath>
+#include <memory>
 #include <string>
 #include <sstream>
 #include <vector>
 #include <random>
 
-#include "json/json.h"
-
 #include "neural_net/NeuralNetwork.h"
+#include "neural_net/TrainSample.h"
+#include "neural_net/TrainSampleFile.h"
+#include "JsonGameDecoder.h"
+#include "MappedDataSource.h"
+#include "StreamingDataReader.h"
 
-using neural_net::NeuralNetworkWrapper;
-
-class JsonDataParser : public NeuralNetworkWrapper::IInputGetter
+class Trainer
 {
 public:
-	JsonDataParser(Json::Value const& obj) : obj_(obj) {
+	static constexpr int kMinTurn = 5; // boards in early turns are not used
+	static constexpr int kDecodeThreads = 4;
+	static constexpr size_t kPrefetchFiles = 256;
+	static constexpr size_t kShuffleBufferSize = 100000;
+	static constexpr double kValidationRate = 0.3; // 30% for validation
+
+	Trainer(unsigned int seed) :
+		seed_(seed), rand_(seed),
+		train_files_(), validate_files_(),
+		binary_files_(),
+		train_games_(kShuffleBufferSize, kMinTurn, seed),
+		validate_games_(1, kMinTurn, seed),
+		net_()
+	{
+		net_.InitializeTrain();
 	}
 
-	double GetField(
-		NeuralNetworkWrapper::FieldSide field_side,
-		NeuralNetworkWrapper::FieldType field_type,
-		int arg1 = 0) override final
-	{
-		if (field_side == NeuralNetworkWrapper::kCurrent) {
-			return GetSideField(field_type, arg1, obj_["current_player"]);
-		}
-		else if (field_side == NeuralNetworkWrapper::kOpponent) {
-			return GetSideField(field_type, arg1, obj_["opponent_player"]);
-		}
-		throw std::runtime_error("invalid side");
+	// A binary train-sample file is split by games;
+	// a JSON file contains only one game.
+	void AddFile(std::string const& filename) {
+		if (IsBinaryFile(filename)) AddBinaryFile(filename);
+		else AddJsonFile(filename);
 	}
 
-private:
-	double GetSideField(NeuralNetworkWrapper::FieldType field_type, int arg1, Json::Value const& side) {
-		switch (field_type) {
-		case NeuralNetworkWrapper::kResourceCurrent:
-		case NeuralNetworkWrapper::kResourceTotal:
-		case NeuralNetworkWrapper::kResourceOverload:
-		case NeuralNetworkWrapper::kResourceOverloadNext:
-			return GetResourceField(field_type, arg1, side["resource"]);
+	void Train(int threads)
+	{
+		if (!binary_files_.empty()) {
+			if (!train_files_.empty() || !validate_files_.empty()) {
+				throw std::runtime_error("Mixed JSON and binary files. Convert JSON files first.");
+			}
 
-		case NeuralNetworkWrapper::kHeroHP:
-		case NeuralNetworkWrapper::kHeroArmor:
-			return GetHeroField(field_type, arg1, side["hero"]);
+			std::cout << "Training games: " << train_games_.GetGameCount()
+				<< ", validation games: " << validate_games_.GetGameCount() << std::endl;
+			net_.TrainStreaming(&train_games_, &validate_games_, threads, seed_);
+			return;
+		}
 
-		case NeuralNetworkWrapper::kMinionCount:
-		case NeuralNetworkWrapper::kMinionHP:
-		case NeuralNetworkWrapper::kMinionMaxHP:
-		case NeuralNetworkWrapper::kMinionAttack:
-		case NeuralNetworkWrapper::kMinionAttackable:
-		case NeuralNetworkWrapper::kMinionTaunt:
-		case NeuralNetworkWrapper::kMinionShield:
-		case NeuralNetworkWrapper::kMinionStealth:
-			return GetMinionsField(field_type, arg1, side["minions"]);
+		std::cout << "Training files: " << train_files_.size()
+			<< ", validation files: " << validate_files_.size() << std::endl;
 
-		case NeuralNetworkWrapper::kHandCount:
-		case NeuralNetworkWrapper::kHandPlayable:
-		case NeuralNetworkWrapper::kHandCost:
-			return GetHandField(field_type, arg1, side["hand"]);
+		auto decoder = [](std::string const& filename, std::vector<neural_net::TrainSample> & samples) {
+			JsonGameDecoder()(filename, samples);
+			samples.erase(
+				std::remove_if(samples.begin(), samples.end(), [](neural_net::TrainSample const& sample) {
+					return sample.turn < kMinTurn;
+				}),
+				samples.end());
+		};
 
-		case NeuralNetworkWrapper::kHeroPowerPlayable:
-			return GetHeroPowerField(field_type, arg1, side["hero_power"]);
+		StreamingDataReader train_data(train_files_, decoder,
+			kDecodeThreads, kPrefetchFiles, kShuffleBufferSize, seed_);
+		StreamingDataReader validate_data(validate_files_, decoder,
+			kDecodeThreads, kPrefetchFiles, 1, seed_);
 
-		default:
-			throw std::runtime_error("unknown field type");
-		}
+		net_.TrainStreaming(&train_data, &validate_data, threads, seed_);
 	}
 
-	double GetResourceField(NeuralNetworkWrapper::FieldType field_type, int arg1, Json::Value const& resource) {
-		switch (field_type) {
-		case NeuralNetworkWrapper::kResourceCurrent:
-			return resource["current"].asInt();
-		case NeuralNetworkWrapper::kResourceTotal:
-			return resource["total"].asInt();
-		case NeuralNetworkWrapper::kResourceOverload:
-			return resource["overload_current"].asInt();
-		case NeuralNetworkWrapper::kResourceOverloadNext:
-			return resource["overload_next"].asInt();
-		default:
-			throw std::runtime_error("unknown field type");
-		}
+private:
+	static bool IsBinaryFile(std::string const& filename) {
+		static std::string const kExtension = ".bin";
+		if (filename.size() < kExtension.size()) return false;
+		return filename.compare(filename.size() - kExtension.size(), kExtension.size(), kExtension) == 0;
 	}
 
-	double GetHeroField(NeuralNetworkWrapper::FieldType field_type, int arg1, Json::Value const& hero) {
-		switch (field_type) {
-		case NeuralNetworkWrapper::kHeroHP:
-			return hero["hp"].asInt();
-		case NeuralNetworkWrapper::kHeroArmor:
-			return hero["armor"].asInt();
-		default:
-			throw std::runtime_error("unknown field type");
-		}
+	bool ForValidate() {
+		std::uniform_real_distribution<double> unif(0.0, 1.0);
+		return unif(rand_) < kValidationRate;
 	}
 
-	double GetMinionsField(NeuralNetworkWrapper::FieldType field_type, int minion_idx, Json::Value const& minions) {
-		switch (field_type) {
-		case NeuralNetworkWrapper::kMinionCount:
-			return minions.size();
-		case NeuralNetworkWrapper::kMinionHP:
-			return minions[minion_idx]["hp"].asInt();
-		case NeuralNetworkWrapper::kMinionMaxHP:
-			return minions[minion_idx]["max_hp"].asInt();
-		case NeuralNetworkWrapper::kMinionAttack:
-			return minions[minion_idx]["attack"].asInt();
-		case NeuralNetworkWrapper::kMinionAttackable:
-			return minions[minion_idx]["attackable"].asBool();
-		case NeuralNetworkWrapper::kMinionTaunt:
-			return minions[minion_idx]["taunt"].asBool();
-		case NeuralNetworkWrapper::kMinionShield:
-			return minions[minion_idx]["shield"].asBool();
-		case NeuralNetworkWrapper::kMinionStealth:
-			return minions[minion_idx]["stealth"].asBool();
-		default:
-			throw std::runtime_error("unknown field type");
-		}
+	void AddJsonFile(std::string const& filename) {
+		if (ForValidate()) validate_files_.push_back(filename);
+		else train_files_.push_back(filename);
 	}
 
-	double GetHandField(NeuralNetworkWrapper::FieldType field_type, int hand_idx, Json::Value const& hand) {
-		switch (field_type) {
-		case NeuralNetworkWrapper::kHandCount:
-			return hand.size();
-		case NeuralNetworkWrapper::kHandPlayable:
-			return hand[hand_idx]["playable"].asBool();
-		case NeuralNetworkWrapper::kHandCost:
-			return hand[hand_idx]["cost"].asInt();
-		default:
-			throw std::runtime_error("unknown field type");
+	void AddBinaryFile(std::string const& filename) {
+		binary_files_.push_back(std::make_unique<neural_net::TrainSampleFileReader>());
+		auto & file = *binary_files_.back();
+		if (!file.Open(filename)) {
+			throw std::runtime_error("Failed when loading file " + filename);
 		}
-	}
 
-	double GetHeroPowerField(NeuralNetworkWrapper::FieldType field_type, int arg1, Json::Value const& hero_power) {
-		switch (field_type) {
-		case NeuralNetworkWrapper::kHeroPowerPlayable:
-			return hero_power["playable"].asBool();
-		default:
-			throw std::runtime_error("unknown field type");
+		for (size_t idx = 0; idx < file.GetGameCount(); ++idx) {
+			if (ForValidate()) validate_games_.AddGame(file, idx);
+			else train_games_.AddGame(file, idx);
 		}
 	}
 
 private:
-	Json::Value const& obj_;
+	unsigned int seed_;
+	std::mt19937 rand_;
+	std::vector<std::string> train_files_;
+	std::vector<std::string> validate_files_;
+	std::vector<std::unique_ptr<neural_net::TrainSampleFileReader>> binary_files_;
+	MappedDataSource train_games_;
+	MappedDataSource validate_games_;
+	NeuralNetworkWrapper net_;
 };
 
-class Trainer
+int main(int argc, char **argv)
 {
-public:
-	Trainer() : net_() {
-		net_.InitializeTrain();
-	}
-
-	void AddJsonFile(std::string const& filename, bool for_validate) {
-		Json::Value obj;
-		Json::Reader reader;
-		std::ifstream fs(filename);
-		reader.parse(fs, obj);
-
-		std::string result = GetResult(obj);
-		int seq = 1;
-		for (Json::ArrayIndex idx = 0; idx < obj.size(); ++idx) {
-			if (obj[idx]["type"].asString() == "kMainAction") {
-				Json::Value const& board = obj[idx]["board"];
-
-				if (board["turn"].asInt() <= 4) continue;
-
-				JsonDataParser board_parser(board);
-				int label = IsCurrentPlayerWin(board, result) ? 1 : -1;
-
-				net_.AddTrainData(&board_parser, label, for_validate);
-				++seq;
-			}
-		}
-	}
-
-	void Train()
-	{
-		net_.Train();
+	if (argc < 2 || argc > 4) {
+		std::cout << "Usage: (program) (dirname) [threads] [seed]" << std::endl;
+		std::cout << "\tthreads: 0 (default) to use all cores" << std::endl;
+		std::cout << "\tfiles listed in (dirname)/filelist are either recorded JSON games," << std::endl;
+		std::cout << "\tor binary train-sample files (*.bin)" << std::endl;
+		return -1;
 	}
 
-private:
-	std::string GetResult(Json::Value const& obj) {
-		for (Json::ArrayIndex idx = 0; idx < obj.size(); ++idx) {
-			if (obj[idx]["type"].asString() == "kEnd") {
-				return obj[idx]["result"].asString();
-			}
-		}
-		throw std::runtime_error("Cannot find win player");
-	}
+	std::string dirname = argv[1];
 
-	bool IsResultWin(std::string const& win_player) {
-		if (win_player == "kResultFirstPlayerWin") return true;
-		if (win_player == "kResultSecondPlayerWin") return false;
-		if (win_player == "kResultDraw") return false;
-		throw std::runtime_error("Failed to parse winning player");
+	int threads = 0;
+	if (argc >= 3) {
+		std::istringstream ss(argv[2]);
+		ss >> threads;
 	}
 
-	bool IsCurrentPlayerWin(Json::Value const& board, std::string const& result) {
-		std::string current_player = board["current_player_id"].asString();
-
-		bool current_player_is_first = false;
-		if (current_player == "kFirstPlayer") current_player_is_first = true;
-		else if (current_player == "kSecondPlayer") current_player_is_first = false;
-		else throw std::runtime_error("Failed to parse current player");
-
-		// Note: AI is always helping first player
-		bool win_player_is_first = IsResultWin(result);
-
-		return current_player_is_first == win_player_is_first;
+	unsigned int seed = std::random_device()();
+	if (argc >= 4) {
+		std::istringstream ss(argv[3]);
+		ss >> seed;
 	}
 
-private:
-	NeuralNetworkWrapper net_;
-};
+	Trainer trainer(seed);
 
-int main(int argc, char **argv)
-{
-	if (argc != 2) {
-		std::cout << "Usage: (program) (dirname)" << std::endl;
-		return -1;
-	}
-
-	Trainer trainer;
-
-	std::string dirname = argv[1];
 	std::string filelist_path = dirname + "/filelist";
 
 	std::cout << "Reading from dir: " << dirname << std::endl;
@@ -231,35 +150,17 @@ int main(int argc, char **argv)
 
 	std::ifstream filelist(filelist_path);
 
-	int loaded_files = 0;
-	std::random_device rand_dev;
-	std::mt19937 rand(rand_dev());
-
-	double validation_case_rate = 0.3; // 30% for validation
-
+	// Only the file names (or the game index of binary files) are read here;
+	// the samples are read lazily during training
 	while (filelist) {
 		std::string filename;
 		filelist >> filename;
 		if (filename.empty()) continue;
 
-		std::uniform_real_distribution<double> unif(0.0, 1.0);
-		bool for_validate = unif(rand) < validation_case_rate;
-
-		try {
-			trainer.AddJsonFile(dirname + "/" + filename, for_validate);
-		}
-		catch (...) {
-			std::cout << "Failed when loading file " << filename << std::endl;
-			throw;
-		}
-
-		++loaded_files;
-		if (loaded_files % 100 == 0) {
-			std::cout << "Loaded " << loaded_files << " files" << std::endl;
-		}
+		trainer.AddFile(dirname + "/" + filename);
 	}
 
-	trainer.Train();
+	trainer.Train(threads);
 
 	return 0;
 }
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <time.h>
+
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "engine/JsonSerializer.h"
+#include "judge/Recorder.h"
+#include "neural_net/StateDataBridge.h"
+#include "neural_net/TrainSample.h"
+#include "neural_net/TrainSampleFile.h"
+
+// Records games as JSON like judge::JsonRecorder, and also appends the boards
+// of main actions to a binary train-sample file.
+// Each process writes to its own file, so generators can run in parallel.
+class TrainSampleRecorder
+{
+public:
+	TrainSampleRecorder(std::mt19937 & rand) :
+		json_recorder_(rand), writer_(), state_bridge_(), samples_(), current_player_is_first_()
+	{
+		std::string filename = GetFilename(rand);
+		if (!writer_.Open(filename)) {
+			throw std::runtime_error("Failed to open train-sample file " + filename);
+		}
+	}
+
+	void Start() {
+		json_recorder_.Start();
+		samples_.clear();
+		current_player_is_first_.clear();
+	}
+
+	void RecordMainAction(state::State const& state, engine::MainOpType op)
+	{
+		json_recorder_.RecordMainAction(state, op);
+
+		// read the state directly, rather than parsing another JSON serialization of the board
+		state_bridge_.Reset(state);
+		samples_.emplace_back();
+		samples_.back().Fill(&state_bridge_, 0, state.GetTurn()); // label is known when game ends
+		current_player_is_first_.push_back(state.GetCurrentPlayerId().IsFirst());
+	}
+
+	void RecordRandomAction(int exclusive_max, int action) {
+		json_recorder_.RecordRandomAction(exclusive_max, action);
+	}
+
+	void RecordManualAction(engine::ActionType::Types action_type, engine::ActionChoices const& action_choices, int action) {
+		json_recorder_.RecordManualAction(action_type, action_choices, action);
+	}
+
+	void End(engine::Result result) {
+		json_recorder_.End(result);
+
+		// Note: AI is always helping first player; a draw counts as a loss of the first player
+		bool first_player_win = (result == engine::kResultFirstPlayerWin);
+		for (size_t idx = 0; idx < samples_.size(); ++idx) {
+			samples_[idx].label = (current_player_is_first_[idx] == first_player_win) ? 1 : -1;
+		}
+		writer_.AppendGame(samples_, first_player_win);
+	}
+
+private:
+	static std::string GetFilename(std::mt19937 & rand) {
+		time_t now;
+		time(&now);
+
+		struct tm timeinfo;
+#ifdef _MSC_VER
+		localtime_s(&timeinfo, &now);
+#else
+		localtime_r(&now, &timeinfo);
+#endif
+
+		char buffer[80];
+		strftime(buffer, 80, "%Y%m%d-%H%M%S", &timeinfo);
+
+		std::ostringstream ss;
+		int postfix = rand() % 90000 + 10000;
+		ss << "train_samples-" << buffer << "-" << postfix << ".bin";
+		return ss.str();
+	}
+
+private:
+	judge::JsonRecorder json_recorder_;
+	neural_net::TrainSampleFileWriter writer_;
+	neural_net::StateDataBridge state_bridge_;
+	std::vector<neural_net::TrainSample> samples_;
+	std::vector<bool> current_player_is_first_;
+};
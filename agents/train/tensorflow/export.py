@@ -0,0 +1,69 @@
+#!/usr/bin/python3
+
+# Export the latest checkpoint in 'model_output' to a weight file,
+# which is loaded by neural_net::TensorFlowModel on the C++ side.
+#
+# Usage: export.py [model_dir] [output_file]
+
+import struct
+import sys
+
+import numpy
+import tensorflow as tf
+
+kMagic = b'HSTF'
+kVersion = 1
+
+# optimizer slots and bookkeeping variables are not needed for inference
+kSkippedSuffixes = ('/Adam', '/Adam_1')
+kSkippedNames = ('global_step', 'beta1_power', 'beta2_power')
+
+
+def get_weights(model_dir):
+  checkpoint = tf.train.latest_checkpoint(model_dir)
+  if checkpoint is None:
+    raise RuntimeError('No checkpoint found in %s' % model_dir)
+  print('Reading checkpoint: %s' % checkpoint)
+
+  reader = tf.train.NewCheckpointReader(checkpoint)
+  weights = {}
+  for name in sorted(reader.get_variable_to_shape_map()):
+    if name in kSkippedNames or name.endswith(kSkippedSuffixes):
+      continue
+    if 'card_embed_matrix' in name:
+      raise RuntimeError('Card-id embeddings are not supported: %s' % name)
+    weights[name] = reader.get_tensor(name)
+  return weights
+
+
+def write_weights(filename, weights):
+  with open(filename, 'wb') as f:
+    f.write(kMagic)
+    f.write(struct.pack('<II', kVersion, len(weights)))
+
+    for name in sorted(weights):
+      value = numpy.asarray(weights[name], dtype='<f4')
+      encoded_name = name.encode('utf-8')
+
+      f.write(struct.pack('<I', len(encoded_name)))
+      f.write(encoded_name)
+      f.write(struct.pack('<I', value.ndim))
+      f.write(struct.pack('<%dI' % value.ndim, *value.shape))
+      f.write(numpy.ascontiguousarray(value).tobytes())
+
+      print('Exported %s %s' % (name, list(value.shape)))
+
+
+def main():
+  model_dir = 'model_output'
+  output_file = 'tf_model.bin'
+  if len(sys.argv) > 1:
+    model_dir = sys.argv[1]
+  if len(sys.argv) > 2:
+    output_file = sys.argv[2]
+
+  write_weights(output_file, get_weights(model_dir))
+
+
+if __name__ == "__main__":
+  main()
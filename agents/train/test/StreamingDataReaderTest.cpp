@@ -0,0 +1,193 @@
+#include <assert.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "StreamingDataReader.h"
+
+// Each shard decodes to kSamplesPerShard samples
+// A sample is identified by (shard, index), stored as the current player's resources
+static constexpr int kShards = 20;
+static constexpr int kSamplesPerShard = 50;
+
+struct DecodeCounter
+{
+	DecodeCounter() : decoded(0) {}
+	std::atomic<int> decoded;
+};
+
+static std::vector<std::string> GetShards()
+{
+	std::vector<std::string> shards;
+	for (int i = 0; i < kShards; ++i) shards.push_back(std::to_string(i));
+	return shards;
+}
+
+static StreamingDataReader::Decoder GetDecoder(DecodeCounter & counter)
+{
+	return [&counter](std::string const& shard, std::vector<neural_net::TrainSample> & samples) {
+		int shard_idx = std::stoi(shard);
+		for (int i = 0; i < kSamplesPerShard; ++i) {
+			neural_net::TrainSample sample = neural_net::TrainSample();
+			sample.current.resource_current = (int16_t)shard_idx;
+			sample.current.resource_total = (int16_t)i;
+			sample.label = (i % 2) ? 1 : -1;
+			samples.push_back(sample);
+		}
+		++counter.decoded;
+	};
+}
+
+// @return Sample ids (shard * kSamplesPerShard + index) in the returned order
+static std::vector<int> ReadPass(StreamingDataReader & reader)
+{
+	std::vector<int> ids;
+	reader.Rewind();
+	while (true) {
+		int label = 0;
+		auto * getter = reader.GetNext(&label);
+		if (!getter) break;
+
+		int shard_idx = (int)getter->GetField(neural_net::NeuralNetworkWrapper::kCurrent, neural_net::NeuralNetworkWrapper::kResourceCurrent);
+		int idx = (int)getter->GetField(neural_net::NeuralNetworkWrapper::kCurrent, neural_net::NeuralNetworkWrapper::kResourceTotal);
+		assert(label == ((idx % 2) ? 1 : -1));
+		ids.push_back(shard_idx * kSamplesPerShard + idx);
+	}
+	return ids;
+}
+
+static void CheckIsPermutation(std::vector<int> const& ids)
+{
+	assert(ids.size() == kShards * kSamplesPerShard);
+	std::set<int> unique(ids.begin(), ids.end());
+	assert(unique.size() == ids.size());
+	assert(*unique.begin() == 0);
+	assert(*unique.rbegin() == kShards * kSamplesPerShard - 1);
+}
+
+static std::vector<int> Read(int threads, size_t prefetch, size_t shuffle_buffer, unsigned int seed)
+{
+	DecodeCounter counter;
+	StreamingDataReader reader(GetShards(), GetDecoder(counter), threads, prefetch, shuffle_buffer, seed);
+	return ReadPass(reader);
+}
+
+static void TestEverySampleOncePerPass()
+{
+	DecodeCounter counter;
+	StreamingDataReader reader(GetShards(), GetDecoder(counter), 4, 3, 128, 1);
+
+	auto pass1 = ReadPass(reader);
+	CheckIsPermutation(pass1);
+	assert(counter.decoded == kShards);
+
+	auto pass2 = ReadPass(reader);
+	CheckIsPermutation(pass2);
+	assert(counter.decoded == kShards * 2);
+	assert(pass1 != pass2);
+}
+
+static void TestIndependentOfThreads()
+{
+	for (unsigned int seed = 1; seed <= 3; ++seed) {
+		auto ids = Read(1, 1, 64, seed);
+		assert(Read(4, 1, 64, seed) == ids);
+		assert(Read(4, 8, 64, seed) == ids);
+	}
+}
+
+static void TestShuffleBuffer()
+{
+	// With a buffer of one sample, shards are returned contiguously
+	auto ordered = Read(2, 2, 1, 7);
+	CheckIsPermutation(ordered);
+	for (size_t i = 0; i < ordered.size(); ++i) {
+		if (i % kSamplesPerShard == 0) continue;
+		assert(ordered[i] == ordered[i - 1] + 1);
+	}
+
+	// The shard order only depends on the seed, so 'ordered' is the input order of the buffer
+	// A sample enters the buffer no later than the output position + (buffer size - 1)
+	std::vector<size_t> input_pos(ordered.size());
+	for (size_t i = 0; i < ordered.size(); ++i) input_pos[ordered[i]] = i;
+
+	for (size_t buffer_size : { 16, 128, 4096 }) {
+		auto shuffled = Read(2, 2, buffer_size, 7);
+		CheckIsPermutation(shuffled);
+		assert(shuffled != ordered);
+
+		size_t max_displacement = 0;
+		for (size_t i = 0; i < shuffled.size(); ++i) {
+			size_t pos = input_pos[shuffled[i]];
+			assert(pos < i + buffer_size);
+			if (pos < i) max_displacement = std::max(max_displacement, i - pos);
+		}
+		// samples are mixed beyond a single shard once the buffer is large enough
+		if (buffer_size > (size_t)kSamplesPerShard) assert(max_displacement > (size_t)kSamplesPerShard);
+	}
+}
+
+static void WaitForDecoded(DecodeCounter & counter, int expected)
+{
+	auto until = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (counter.decoded < expected) {
+		assert(std::chrono::steady_clock::now() < until);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	// give the workers a chance to run ahead, if they would
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	assert(counter.decoded == expected);
+}
+
+static void TestPrefetch()
+{
+	for (size_t prefetch : { 1, 3, 8 }) {
+		DecodeCounter counter;
+		StreamingDataReader reader(GetShards(), GetDecoder(counter), 4, prefetch, 1, 1);
+
+		// workers decode ahead of the consumer, but at most 'prefetch' shards
+		reader.Rewind();
+		WaitForDecoded(counter, (int)prefetch);
+
+		// consuming a shard frees one prefetch slot
+		int label = 0;
+		assert(reader.GetNext(&label));
+		WaitForDecoded(counter, (int)prefetch + 1);
+
+		// the rest of the shard is already decoded
+		for (int i = 1; i < kSamplesPerShard; ++i) assert(reader.GetNext(&label));
+		WaitForDecoded(counter, (int)prefetch + 1);
+	}
+
+	// prefetch is bounded by the number of shards
+	DecodeCounter counter;
+	StreamingDataReader reader(GetShards(), GetDecoder(counter), 4, kShards * 2, 1, 1);
+	reader.Rewind();
+	WaitForDecoded(counter, kShards);
+}
+
+int main()
+{
+	std::cout << "Testing every sample is returned once per pass...";
+	TestEverySampleOncePerPass();
+	std::cout << " Done." << std::endl;
+
+	std::cout << "Testing the order is independent of threads...";
+	TestIndependentOfThreads();
+	std::cout << " Done." << std::endl;
+
+	std::cout << "Testing the shuffle buffer...";
+	TestShuffleBuffer();
+	std::cout << " Done." << std::endl;
+
+	std::cout << "Testing prefetch...";
+	TestPrefetch();
+	std::cout << " Done." << std::endl;
+
+	return 0;
+}
@@ -26,7 +26,9 @@ namespace Cards
 					.SetUpdatePolicy(UpdatePolicy)
 					.SetEmitPolicy(EmitPolicy::emit_policy)
 					.SetEffect(engine::FlowControl::aura::EffectHandler_Enchantments()
-						.SetGetTargets(HandleClass::GetAuraTargets)
+						.SetGetTargets([](engine::FlowControl::aura::contexts::AuraGetTargets const& context) {
+							HandleClass::GetAuraTargets(context);
+						})
 						.template SetEnchantmentType<EnchantmentType>()
 					));
 			};
@@ -46,7 +48,9 @@ namespace Cards
 					.SetUpdatePolicy(UpdatePolicy)
 					.SetEmitPolicy(EmitPolicy::emit_policy)
 					.SetEffect(engine::FlowControl::aura::EffectHandler_Enchantment()
-						.SetGetTarget(HandleClass::GetAuraTarget)
+						.SetGetTarget([](engine::FlowControl::aura::contexts::AuraGetTarget const& context) {
+							HandleClass::GetAuraTarget(context);
+						})
 						.template SetEnchantmentType<EnchantmentType>()
 					));
 			};
@@ -63,8 +67,12 @@ namespace Cards
 					.SetUpdatePolicy(UpdatePolicy)
 					.SetEmitPolicy(EmitPolicy::emit_policy)
 					.SetEffect(engine::FlowControl::aura::EffectHandler_BoardFlag()
-						.SetApplyOn(HandleClass::AuraApplyOn)
-						.SetRemoveFrom(HandleClass::AuraRemoveFrom)
+						.SetApplyOn([](engine::FlowControl::aura::contexts::AuraApplyFlagOnBoard const& context) {
+							HandleClass::AuraApplyOn(context);
+						})
+						.SetRemoveFrom([](engine::FlowControl::aura::contexts::AuraRemoveFlagFromBoard const& context) {
+							HandleClass::AuraRemoveFrom(context);
+						})
 					));
 			};
 		}
@@ -80,8 +88,12 @@ namespace Cards
 					.SetUpdatePolicy(UpdatePolicy)
 					.SetEmitPolicy(EmitPolicy::emit_policy)
 					.SetEffect(engine::FlowControl::aura::EffectHandler_OwnerPlayerFlag()
-						.SetApplyOn(HandleClass::AuraApplyOn)
-						.SetRemoveFrom(HandleClass::AuraRemoveFrom)
+						.SetApplyOn([](engine::FlowControl::aura::contexts::AuraApplyFlagOnOwnerPlayer const& context) {
+							HandleClass::AuraApplyOn(context);
+						})
+						.SetRemoveFrom([](engine::FlowControl::aura::contexts::AuraRemoveFlagFromOwnerPlayer const& context) {
+							HandleClass::AuraRemoveFrom(context);
+						})
 					));
 			};
 		}
@@ -37,13 +37,19 @@ namespace Cards
 	};
 	template <typename T> struct BattlecryProcessor<T, true, false> {
 		static void Process(state::Cards::CardData & card_data) {
-			card_data.onplay_handler.SetOnPlayCallback(&T::Battlecry);
+			card_data.onplay_handler.SetOnPlayCallback([](engine::FlowControl::onplay::context::OnPlay const& context) {
+				T::Battlecry(context);
+			});
 		}
 	};
 	template <typename T> struct BattlecryProcessor<T, true, true> {
 		static void Process(state::Cards::CardData & card_data) {
-			card_data.onplay_handler.SetSpecifyTargetCallback(&T::GetSpecifiedTargets);
-			card_data.onplay_handler.SetOnPlayCallback(&T::Battlecry);
+			card_data.onplay_handler.SetSpecifyTargetCallback([](engine::FlowControl::onplay::context::GetSpecifiedTarget & context) {
+				T::GetSpecifiedTargets(context);
+			});
+			card_data.onplay_handler.SetOnPlayCallback([](engine::FlowControl::onplay::context::OnPlay const& context) {
+				T::Battlecry(context);
+			});
 		}
 	};
 }
\ No newline at end of file
@@ -1,6 +1,14 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
 #include "Cards/CardDispatcher.h"
+#include "Cards/CardTraits.h"
+#include "Cards/CardIdSet.h"
 
 #include "state/State.h"
 #include "engine/FlowControl/FlowController.h"
@@ -53,10 +61,21 @@ namespace Cards
 
 #undef CREATE_INVOKER
 
+		template <typename T> class VanillaInvoker
+		{
+		public:
+			static bool Invoke()
+			{
+				return CardTraits<T>::kVanilla;
+			}
+		};
+
 		template <int id>
 		class DefaultInvoked : public Cards::GeneralCardBase<void>
 		{
 		public:
+			static constexpr bool kVanilla = true; // no handlers for a card without its own class
+
 			DefaultInvoked()
 			{
 				auto const& data = Cards::Database::GetInstance().Get((Cards::CardId)id);
@@ -65,8 +84,80 @@ namespace Cards
 		};
 	}
 
+	namespace detail
+	{
+		class CardPrototypes
+		{
+		public:
+			// Rebuilt once the cards are reloaded (see Cards::Database::GetGeneration())
+			// Never destroyed (even the outdated ones), since the cards in any state might borrow the handlers
+			static CardPrototypes const& GetInstance() {
+				static std::atomic<CardPrototypes const*> instance(nullptr);
+
+				int const generation = Cards::Database::GetInstance().GetGeneration();
+				CardPrototypes const* current = instance.load(std::memory_order_acquire);
+				if (current && current->generation_ == generation) return *current;
+
+				static std::mutex mutex;
+				std::lock_guard<std::mutex> lock(mutex);
+				current = instance.load(std::memory_order_relaxed);
+				if (!current || current->generation_ != generation) {
+					current = new CardPrototypes(generation);
+					instance.store(current, std::memory_order_release);
+				}
+				return *current;
+			}
+
+			state::Cards::Card const& Get(CardId id, state::PlayerIdentifier player) const {
+				assert(player.AssertCheck());
+				if ((int)id < 0 || (int)id >= (int)prototypes_.size()) throw std::runtime_error("Invalid id");
+				return prototypes_[id][player.IsFirst() ? 0 : 1];
+			}
+
+			bool IsVanilla(CardId id) const { return vanilla_.Contains(id); }
+
+		private:
+			explicit CardPrototypes(int generation) : generation_(generation), prototypes_(), vanilla_() {
+				prototypes_.reserve(MAX_ID + 1);
+				for (int id = 0; id <= MAX_ID; ++id) {
+					prototypes_.push_back({
+						Create((CardId)id, state::PlayerIdentifier::First()),
+						Create((CardId)id, state::PlayerIdentifier::Second())
+					});
+
+					if (CardDispatcher::DispatcherImpl::Invoke<detail::VanillaInvoker, bool>(id)) {
+						assert(prototypes_.back()[0].GetOnPlayHandler().Empty());
+						vanilla_.Add((CardId)id);
+					}
+				}
+			}
+
+			static state::Cards::Card Create(CardId id, state::PlayerIdentifier player) {
+				state::Cards::CardData data = CardDispatcher::CreateInstance(id);
+				data.enchanted_states.player = player;
+				data.enchantment_handler.SetOriginalStates(data.enchanted_states);
+				return state::Cards::Card(std::move(data));
+			}
+
+		private:
+			int generation_;
+			std::vector<std::array<state::Cards::Card, 2>> prototypes_;
+			CardIdSet vanilla_;
+		};
+	}
+
 	state::Cards::CardData CardDispatcher::CreateInstance(CardId id)
 	{
 		return DispatcherImpl::Invoke<detail::ConstructorInvoker, state::Cards::CardData>((int)id);
 	}
+
+	state::Cards::Card const& CardDispatcher::GetPrototype(CardId id, state::PlayerIdentifier player)
+	{
+		return detail::CardPrototypes::GetInstance().Get(id, player);
+	}
+
+	bool CardDispatcher::IsVanilla(CardId id)
+	{
+		return detail::CardPrototypes::GetInstance().IsVanilla(id);
+	}
 }
\ No newline at end of file
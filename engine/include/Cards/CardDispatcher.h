@@ -1,9 +1,12 @@
 #pragma once
 
 #include "Utils/StaticDispatcher.h"
+#include "state/Types.h"
 #include "state/Cards/CardData.h"
 #include "Cards/id-map.h"
 
+namespace state { namespace Cards { class Card; } }
+
 namespace Cards
 {
 	namespace detail
@@ -15,6 +18,16 @@ namespace Cards
 	{
 	public:
 		using DispatcherImpl = Utils::StaticDispatcher<detail::DefaultInvoked>;
+
+		// Constructs the card class, and registers all its handlers
 		static state::Cards::CardData CreateInstance(CardId id);
+
+		// A card built by CreateInstance() once for each card id and owner, and kept for the whole process
+		// New cards should borrow the handlers by state::Cards::Card::RefCopy(); they are copied when first modified.
+		// The prototypes are built from the card database when this is first called.
+		static state::Cards::Card const& GetPrototype(CardId id, state::PlayerIdentifier player);
+
+		// The trait CardTraits::kVanilla of the card class, looked up at runtime (see Cards/CardTraits.h)
+		static bool IsVanilla(CardId id);
 	};
 }
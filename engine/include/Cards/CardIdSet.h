@@ -0,0 +1,82 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <array>
+
+#include "Utils/Bits.h"
+#include "Cards/id-map.h"
+
+namespace Cards
+{
+	// A set of card ids as a dense bitset
+	// The sets are combined by '&' and '|', and the ids are enumerated in increasing order.
+	class CardIdSet
+	{
+	public:
+		static constexpr int kMaxCards = MAX_ID + 1;
+		static constexpr int kWords = (kMaxCards + 63) / 64;
+
+		CardIdSet() : words_() {}
+
+		void Add(CardId id) {
+			assert((int)id >= 0 && (int)id < kMaxCards);
+			words_[id / 64] |= (uint64_t)1 << (id % 64);
+		}
+
+		bool Contains(CardId id) const {
+			assert((int)id >= 0 && (int)id < kMaxCards);
+			return (words_[id / 64] & ((uint64_t)1 << (id % 64))) != 0;
+		}
+
+		CardIdSet & operator&=(CardIdSet const& rhs) {
+			for (int i = 0; i < kWords; ++i) words_[i] &= rhs.words_[i];
+			return *this;
+		}
+		CardIdSet & operator|=(CardIdSet const& rhs) {
+			for (int i = 0; i < kWords; ++i) words_[i] |= rhs.words_[i];
+			return *this;
+		}
+		CardIdSet operator&(CardIdSet const& rhs) const { return CardIdSet(*this) &= rhs; }
+		CardIdSet operator|(CardIdSet const& rhs) const { return CardIdSet(*this) |= rhs; }
+
+		bool Empty() const {
+			for (int i = 0; i < kWords; ++i) {
+				if (words_[i]) return false;
+			}
+			return true;
+		}
+
+		int Count() const {
+			int count = 0;
+			for (int i = 0; i < kWords; ++i) count += Utils::PopCount(words_[i]);
+			return count;
+		}
+
+		// The n-th (zero-based) smallest id
+		// With 'n' drawn uniformly from [0, Count()), this is a uniform random draw from the set
+		CardId Get(int n) const {
+			assert(n >= 0);
+			for (int i = 0; i < kWords; ++i) {
+				int const count = Utils::PopCount(words_[i]);
+				if (n < count) return (CardId)(i * 64 + Utils::SelectBit(words_[i], n));
+				n -= count;
+			}
+			assert(false);
+			return kInvalidCardId;
+		}
+
+		// Functor: bool(CardId), return true to continue; false to abort
+		template <typename Functor>
+		void ForEach(Functor&& functor) const {
+			for (int i = 0; i < kWords; ++i) {
+				for (uint64_t word = words_[i]; word; word &= word - 1) {
+					if (!functor((CardId)(i * 64 + Utils::CountTrailingZeros(word)))) return;
+				}
+			}
+		}
+
+	private:
+		std::array<uint64_t, kWords> words_;
+	};
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <type_traits>
+
+namespace Cards
+{
+	namespace detail {
+		template <typename T, typename = void> struct DeclaredVanilla : std::false_type {};
+		template <typename T> struct DeclaredVanilla<T, std::void_t<decltype(T::kVanilla)>> :
+			std::integral_constant<bool, T::kVanilla> {};
+	}
+
+	// The properties of a card class known at compile time
+	// A card class declares a property by a static member; otherwise, the conservative default is used.
+	// The flow controller plays a card by a specialized path according to these (see CardDispatcher::IsVanilla)
+	template <typename T>
+	struct CardTraits
+	{
+		// Playing the card has no effect of its own: no battlecry, no specified target, no choose-one,
+		//    and no extra playable condition. Keywords and triggers do not matter.
+		// Declared by 'static constexpr bool kVanilla = true;'
+		static constexpr bool kVanilla = detail::DeclaredVanilla<T>::value;
+	};
+}
@@ -143,7 +143,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_CS2_232 : public MinionCardBase<Card_CS2_232, Taunt> {};
+	struct Card_CS2_232 : public VanillaMinionCardBase<Card_CS2_232, Taunt> {};
 }
 
 REGISTER_CARD(CS2_232)
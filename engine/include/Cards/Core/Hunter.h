@@ -45,7 +45,7 @@ namespace Cards
 		Card_DS1_184() {
 			onplay_handler.SetOnPlayCallback([](engine::FlowControl::onplay::context::OnPlay const& context) {
 				auto & deck = context.manipulate_.Board().Player(context.player_).deck_;
-				std::vector<Cards::CardId> cards;
+				engine::FlowControl::CardIdChoices cards;
 				for (int i = 0; i < 3; ++i) {
 					if (deck.Empty()) break;
 					cards.push_back(deck.GetLast());
@@ -72,7 +72,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_NEW1_032 : public MinionCardBase<Card_NEW1_032, Taunt> {};
+	struct Card_NEW1_032 : public VanillaMinionCardBase<Card_NEW1_032, Taunt> {};
 
 	struct Card_NEW1_033o : public Enchantment<Card_NEW1_033o, Attack<1>> {};
 	struct Card_NEW1_033 : public MinionCardBase<Card_NEW1_033> {
@@ -88,7 +88,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_NEW1_034 : public MinionCardBase<Card_NEW1_034, Charge> {};
+	struct Card_NEW1_034 : public VanillaMinionCardBase<Card_NEW1_034, Charge> {};
 
 	struct Card_NEW1_031 : public SpellCardBase<Card_NEW1_031> {
 		Card_NEW1_031() {
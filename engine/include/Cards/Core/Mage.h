@@ -125,7 +125,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_CS2_033 : public MinionCardBase<Card_CS2_033, FreezeAttack> {};
+	struct Card_CS2_033 : public VanillaMinionCardBase<Card_CS2_033, FreezeAttack> {};
 
 	struct Card_CS2_032 : public SpellCardBase<Card_CS2_032> {
 		Card_CS2_032() {
@@ -26,7 +26,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_CS1_042 : public MinionCardBase<Card_CS1_042, Taunt> {};
+	struct Card_CS1_042 : public VanillaMinionCardBase<Card_CS1_042, Taunt> {};
 
 	struct Card_EX1_508o : public Enchantment<Card_EX1_508o, Attack<1>> {};
 	struct Card_EX1_508 : public MinionCardBase<Card_EX1_508> {
@@ -42,7 +42,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_CS2_171 : public MinionCardBase<Card_CS2_171, Charge> {};
+	struct Card_CS2_171 : public VanillaMinionCardBase<Card_CS2_171, Charge> {};
 
 	struct Card_EX1_011 : public MinionCardBase<Card_EX1_011> {
 		static void GetSpecifiedTargets(Contexts::SpecifiedTargetGetter & context) {
@@ -62,8 +62,8 @@ namespace Cards
 		}
 	};
 
-	struct Card_CS2_173 : public MinionCardBase<Card_CS2_173, Charge> {};
-	struct Card_CS2_121 : public MinionCardBase<Card_CS2_121, Taunt> {};
+	struct Card_CS2_173 : public VanillaMinionCardBase<Card_CS2_173, Charge> {};
+	struct Card_CS2_121 : public VanillaMinionCardBase<Card_CS2_121, Taunt> {};
 	struct Card_CS2_142 : public MinionCardBase<Card_CS2_142, SpellDamage<1>> {};
 
 	struct Card_EX1_506 : public MinionCardBase<Card_EX1_506> {
@@ -90,7 +90,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_CS2_125 : public MinionCardBase<Card_CS2_125, Taunt> {};
+	struct Card_CS2_125 : public VanillaMinionCardBase<Card_CS2_125, Taunt> {};
 
 	struct Card_CS2_122e : public Enchantment<Card_CS2_122e, Attack<1>> {};
 	struct Card_CS2_122 : public MinionCardBase<Card_CS2_122> {
@@ -124,8 +124,8 @@ namespace Cards
 		}
 	};
 
-	struct Card_CS2_127 : public MinionCardBase<Card_CS2_127, Taunt> {};
-	struct Card_CS2_124 : public MinionCardBase<Card_CS2_124, Charge> {};
+	struct Card_CS2_127 : public VanillaMinionCardBase<Card_CS2_127, Taunt> {};
+	struct Card_CS2_124 : public VanillaMinionCardBase<Card_CS2_124, Charge> {};
 	struct Card_EX1_025 : public MinionCardBase<Card_EX1_025> {
 		static void Battlecry(Contexts::OnPlay const& context) {
 			SummonToRight(context, Cards::ID_EX1_025t);
@@ -139,9 +139,9 @@ namespace Cards
 	};
 
 	struct Card_CS2_197 : public MinionCardBase<Card_CS2_197, SpellDamage<1>> {};
-	struct Card_CS2_179 : public MinionCardBase<Card_CS2_179, Taunt> {};
-	struct Card_CS2_131 : public MinionCardBase<Card_CS2_131, Charge> {};
-	struct Card_CS2_187 : public MinionCardBase<Card_CS2_187, Taunt> {};
+	struct Card_CS2_179 : public VanillaMinionCardBase<Card_CS2_179, Taunt> {};
+	struct Card_CS2_131 : public VanillaMinionCardBase<Card_CS2_131, Charge> {};
+	struct Card_CS2_187 : public VanillaMinionCardBase<Card_CS2_187, Taunt> {};
 	struct Card_DS1_055 : public MinionCardBase<Card_DS1_055> {
 		static void Battlecry(Contexts::OnPlay const& context) {
 			ForEach(context, Targets(context.player_).Ally().Exclude(context.card_ref_),
@@ -217,8 +217,8 @@ namespace Cards
 	};
 
 	struct Card_CS2_155 : public MinionCardBase<Card_CS2_155, SpellDamage<1>> {};
-	struct Card_CS2_162 : public MinionCardBase<Card_CS2_162, Taunt> {};
-	struct Card_CS2_213 : public MinionCardBase<Card_CS2_213, Charge> {};
+	struct Card_CS2_162 : public VanillaMinionCardBase<Card_CS2_162, Taunt> {};
+	struct Card_CS2_213 : public VanillaMinionCardBase<Card_CS2_213, Charge> {};
 
 	struct Card_CS2_222o : public Enchantment<Card_CS2_222o, Attack<1>, MaxHP<1>> {};
 	struct Card_CS2_222 : public MinionCardBase<Card_CS2_222> {
@@ -22,7 +22,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_CS2_051 : public MinionCardBase<Card_CS2_051, Taunt> {};
+	struct Card_CS2_051 : public VanillaMinionCardBase<Card_CS2_051, Taunt> {};
 
 	struct Card_CS2_052 : public MinionCardBase<Card_CS2_052, SpellDamage<1>> {};
 
@@ -71,7 +71,7 @@ namespace Cards
 			});
 			onplay_handler.SetOnPlayCallback([](engine::FlowControl::onplay::context::OnPlay const& context) {
 				std::array<bool, 4> totems_exists = GetTotemExists(context.manipulate_, context.player_);
-				std::vector<Cards::CardId> totems_candidates;
+				Utils::FixedCapacityVector<Cards::CardId, 4> totems_candidates;
 				for (int i = 0; i < 4; ++i) {
 					if (totems_exists[i]) continue;
 					totems_candidates.push_back(basic_totems_[i]);
@@ -116,7 +116,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_hexfrog : public MinionCardBase<Card_hexfrog, Taunt> {};
+	struct Card_hexfrog : public VanillaMinionCardBase<Card_hexfrog, Taunt> {};
 	struct Card_EX1_246 : public SpellCardBase<Card_EX1_246> {
 		Card_EX1_246() {
 			onplay_handler.SetSpecifyTargetCallback([](engine::FlowControl::onplay::context::GetSpecifiedTarget & context) {
@@ -74,7 +74,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_CS2_065 : public MinionCardBase<Card_CS2_065, Taunt> {};
+	struct Card_CS2_065 : public VanillaMinionCardBase<Card_CS2_065, Taunt> {};
 
 	struct Card_EX1_306 : public MinionCardBase<Card_EX1_306> {
 		static void Battlecry(Contexts::OnPlay const& context) {
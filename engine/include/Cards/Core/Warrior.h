@@ -115,7 +115,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_NEW1_011 : public MinionCardBase<Card_NEW1_011, Charge> {};
+	struct Card_NEW1_011 : public VanillaMinionCardBase<Card_NEW1_011, Charge> {};
 }
 
 REGISTER_CARD(NEW1_011)
@@ -1,14 +1,21 @@
 #pragma once
 
 #include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/types.h>
 #include <string>
 #include <fstream>
+#include <random>
+#include <sstream>
 #include <vector>
 #include <array>
 #include <unordered_set>
 #include <unordered_map>
 #include "json/json.h"
 
+#include "Utils/BinaryArchive.h"
 #include "state/Types.h"
 
 namespace Cards
@@ -66,8 +73,80 @@ namespace Cards
 			return card_sets;
 		}
 
-		bool Initialize(std::string const& path) {
-			return LoadJsonFile(path);
+		// The json file is parsed, unless 'cache_path' is given (opt-in):
+		//    The compiled database at 'cache_path' is then used if it was built from the json file with the
+		//    same size and modification time. Otherwise, the json file is parsed, and the compiled database
+		//    is written there for the next time. If the json file is missing, the compiled database is used as is.
+		// Note: The modification time has a resolution of one second; a json file rewritten within the same
+		//    second, with the same size, is not noticed.
+		bool Initialize(std::string const& path, std::string const& cache_path = std::string()) {
+			loaded_from_cache_ = false;
+
+			FileStamp json_stamp;
+			bool const json_exists = GetFileStamp(path, json_stamp);
+
+			if (!cache_path.empty()) {
+				if (LoadBinaryFile(cache_path, json_exists ? &json_stamp : nullptr)) {
+					loaded_from_cache_ = true;
+					return true;
+				}
+			}
+
+			std::string json_content;
+			if (!ReadFile(path, json_content)) return false;
+			if (!LoadJsonContent(json_content)) return false;
+			json_stamp_ = json_stamp;
+
+			if (!cache_path.empty()) {
+				SaveBinaryFile(cache_path); // best-effort; the json file is parsed again if failed
+			}
+			return true;
+		}
+
+		// If the last Initialize() used the compiled database
+		bool IsLoadedFromCache() const { return loaded_from_cache_; }
+
+		// Increased every time the cards are (re)loaded; the data derived from the cards should be
+		//    rebuilt once it's changed (e.g., the card prototypes in Cards::CardDispatcher)
+		int GetGeneration() const { return generation_; }
+
+		// A cache path next to the json file: "cards.json" --> "cards.bin"
+		static std::string GetBinaryPath(std::string const& json_path) {
+			std::string const ext = ".json";
+			if (json_path.size() >= ext.size() &&
+				json_path.compare(json_path.size() - ext.size(), ext.size(), ext) == 0)
+			{
+				return json_path.substr(0, json_path.size() - ext.size()) + ".bin";
+			}
+			return json_path + ".bin";
+		}
+
+		// The file is written to a temporary file first, so other processes never see a partial file
+		bool SaveBinaryFile(std::string const& path) const {
+			std::vector<uint8_t> buffer;
+			SaveBinary(buffer);
+
+			std::string const temp_path = path + "." + std::to_string(std::random_device()()) + ".tmp";
+			{
+				std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+				file.write(reinterpret_cast<char const*>(buffer.data()), buffer.size());
+				if (!file) {
+					file.close();
+					remove(temp_path.c_str());
+					return false;
+				}
+			}
+
+			if (rename(temp_path.c_str(), path.c_str()) != 0) {
+				remove(temp_path.c_str());
+				return false;
+			}
+			return true;
+		}
+
+		// The compiled database is used as is
+		bool LoadBinaryFile(std::string const& path) {
+			return LoadBinaryFile(path, nullptr);
 		}
 
 		std::unordered_map<std::string, int> const& GetIdMap() const { return origin_id_map_; }
@@ -95,20 +174,49 @@ namespace Cards
 
 	private:
 		Database() : final_cards_(nullptr), final_cards_size_(0), origin_id_map_(),
-			name_id_map_()
+			name_id_map_(), json_stamp_(), loaded_from_cache_(false), generation_(0)
 		{ }
 
 		Database(Database const&) = delete;
 		Database & operator=(Database const&) = delete;
 
-		bool LoadJsonFile(std::string const& path)
+		static bool ReadFile(std::string const& path, std::string & content)
+		{
+			std::ifstream file(path, std::ios::binary);
+			if (!file) return false;
+
+			std::ostringstream ss;
+			ss << file.rdbuf();
+			content = ss.str();
+			return true;
+		}
+
+		// The json file a compiled database was built from
+		struct FileStamp {
+			FileStamp() : size(0), modified_time(0) {}
+
+			bool operator==(FileStamp const& rhs) const { return size == rhs.size && modified_time == rhs.modified_time; }
+			bool operator!=(FileStamp const& rhs) const { return !(*this == rhs); }
+
+			uint64_t size;
+			int64_t modified_time;
+		};
+
+		static bool GetFileStamp(std::string const& path, FileStamp & stamp)
+		{
+			struct stat info;
+			if (stat(path.c_str(), &info) != 0) return false;
+			stamp.size = (uint64_t)info.st_size;
+			stamp.modified_time = (int64_t)info.st_mtime;
+			return true;
+		}
+
+		bool LoadJsonContent(std::string const& content)
 		{
 			Json::Reader reader;
 			Json::Value cards_json;
 
-			std::ifstream cards_file(path);
-
-			if (reader.parse(cards_file, cards_json, false) == false) return false;
+			if (reader.parse(content.data(), content.data() + content.size(), cards_json, false) == false) return false;
 
 			return this->ReadFromJson(cards_json);
 		}
@@ -128,6 +236,14 @@ namespace Cards
 				this->AddCard(card_json, cards);
 			}
 
+			SetCards(cards);
+			return true;
+		}
+
+		void SetCards(std::vector<CardData> const& cards)
+		{
+			++generation_;
+
 			if (final_cards_) { delete[] final_cards_; }
 
 			final_cards_size_ = (int)cards.size();
@@ -137,7 +253,125 @@ namespace Cards
 			for (size_t i = 0; i < cards.size(); ++i) {
 				final_cards_[i] = cards[i];
 			}
+		}
+
+		// Compiled database: the cards in the native byte order, and the stamp of the json file
+		//    it was built from. The name maps are rebuilt when loaded.
+		static constexpr uint32_t kBinaryMagic = 0x44435348; // "HSCD"
+		static constexpr uint32_t kBinaryVersion = 3;
+
+		static void WriteString(Utils::BinaryWriter & writer, std::string const& str)
+		{
+			writer.WriteSize(str.size());
+			writer.WriteBytes(str.data(), str.size());
+		}
+
+		static void ReadString(Utils::BinaryReader & reader, std::string & str)
+		{
+			str.resize(reader.ReadSize());
+			reader.ReadBytes(&str[0], str.size());
+		}
+
+		void SaveBinary(std::vector<uint8_t> & buffer) const
+		{
+			std::vector<std::string const*> origin_ids(final_cards_size_, nullptr);
+			for (auto const& item : origin_id_map_) {
+				origin_ids[item.second] = &item.first;
+			}
+
+			Utils::BinaryWriter writer(buffer);
+			writer.WriteRaw(kBinaryMagic);
+			writer.WriteRaw(kBinaryVersion);
+			writer.WriteRaw(CardData::kFieldChangeId);
+			writer.WriteRaw(json_stamp_.size);
+			writer.WriteRaw(json_stamp_.modified_time);
+			writer.WriteSize(final_cards_size_);
+
+			static_assert(CardData::kFieldChangeId == 3); // write all the fields
+			for (int i = 1; i < final_cards_size_; ++i) {
+				CardData const& card = final_cards_[i];
+				assert(card.card_id == i);
+				assert(origin_ids[i]);
+
+				WriteString(writer, *origin_ids[i]);
+				WriteString(writer, card.name);
+				writer.WriteRaw(card.player_class);
+				writer.WriteRaw(card.card_type);
+				writer.WriteRaw(card.card_race);
+				writer.WriteRaw(card.card_rarity);
+				writer.WriteRaw(card.card_set);
+				writer.WriteRaw(card.cost);
+				writer.WriteRaw(card.attack);
+				writer.WriteRaw(card.max_hp);
+				writer.WriteRaw(card.collectible);
+			}
+		}
+
+		// Fails if the data is malformed, or if it's not built from the json file with 'expected_json_stamp'
+		bool LoadBinaryFile(std::string const& path, FileStamp const* expected_json_stamp)
+		{
+			std::string content;
+			if (!ReadFile(path, content)) return false;
+
+			std::vector<CardData> cards;
+			std::unordered_map<std::string, int> origin_id_map;
+			std::unordered_map<std::string, int> name_id_map;
+			FileStamp json_stamp;
+			try {
+				Utils::BinaryReader reader(reinterpret_cast<uint8_t const*>(content.data()), content.size());
+
+				uint32_t magic;
+				uint32_t version;
+				int field_change_id;
+				reader.ReadRaw(magic);
+				reader.ReadRaw(version);
+				reader.ReadRaw(field_change_id);
+				reader.ReadRaw(json_stamp.size);
+				reader.ReadRaw(json_stamp.modified_time);
+				if (magic != kBinaryMagic) return false;
+				if (version != kBinaryVersion) return false;
+				if (field_change_id != CardData::kFieldChangeId) return false;
+				if (expected_json_stamp && json_stamp != *expected_json_stamp) return false;
+
+				size_t const cards_size = reader.ReadSize();
+				reader.Check(cards_size > 0);
+
+				// Reserve id = 0
+				cards.reserve(cards_size);
+				cards.push_back(CardData());
+
+				std::string origin_id;
+				for (size_t i = 1; i < cards_size; ++i) {
+					CardData card;
+					ReadString(reader, origin_id);
+					ReadString(reader, card.name);
+					card.card_id = (int)i;
+					reader.ReadRaw(card.player_class);
+					reader.ReadRaw(card.card_type);
+					reader.ReadRaw(card.card_race);
+					reader.ReadRaw(card.card_rarity);
+					reader.ReadRaw(card.card_set);
+					reader.ReadRaw(card.cost);
+					reader.ReadRaw(card.attack);
+					reader.ReadRaw(card.max_hp);
+					reader.ReadRaw(card.collectible);
+					cards.push_back(card);
+
+					reader.Check(origin_id_map.emplace(origin_id, card.card_id).second);
+					if (card.collectible) {
+						reader.Check(name_id_map.emplace(card.name, card.card_id).second);
+					}
+				}
+				reader.Check(reader.AtEnd());
+			}
+			catch (std::runtime_error const&) {
+				return false;
+			}
 
+			SetCards(cards);
+			origin_id_map_ = std::move(origin_id_map);
+			name_id_map_ = std::move(name_id_map);
+			json_stamp_ = json_stamp;
 			return true;
 		}
 
@@ -157,6 +391,8 @@ namespace Cards
 			if (player_class == "WARRIOR") return state::PlayerClass::kPlayerClassWarrior;
 			if (player_class == "DEATHKNIGHT") return state::PlayerClass::kPlayerClassDeathKnight;
 
+			if (player_class == "DREAM") return state::PlayerClass::kPlayerClassInvalid; // Ysera's dream cards
+
 			throw std::runtime_error("unknown player class.");
 		}
 
@@ -246,6 +482,8 @@ namespace Cards
 				return;
 			}
 
+			new_card.player_class = GetPlayerClass(json);
+
 			if (json.isMember("collectible")) {
 				new_card.collectible = json["collectible"].asBool();
 			}
@@ -267,7 +505,6 @@ namespace Cards
 			else if (type == "HERO") {
 				new_card.card_type = state::kCardTypeHero;
 				new_card.card_race = GetCardRace(json);
-				new_card.player_class = GetPlayerClass(json);
 				new_card.max_hp = json["health"].asInt();
 				new_card.attack = 0;
 			}
@@ -301,5 +538,9 @@ namespace Cards
 
 		std::unordered_map<std::string, int> origin_id_map_;
 		std::unordered_map<std::string, int> name_id_map_;
+
+		FileStamp json_stamp_; // of the json file which the cards are loaded from
+		bool loaded_from_cache_;
+		int generation_;
 	};
 }
\ No newline at end of file
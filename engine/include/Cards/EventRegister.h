@@ -178,8 +178,12 @@ namespace Cards
 	struct EventsRegisterHelper<Event1, Event2> {
 		static void Process(state::Cards::CardData & card_data) {
 			using CombinedEvent = CombineEvents<Event1, Event2>;
-			card_data.added_to_play_zone += (CombinedEvent::AddedToPlayZone::Invoke);
-			card_data.added_to_hand_zone += (CombinedEvent::AddedToHandZone::Invoke);
+			card_data.added_to_play_zone += [](state::Cards::ZoneChangedContext const& context) {
+				CombinedEvent::AddedToPlayZone::Invoke(context);
+			};
+			card_data.added_to_hand_zone += [](state::Cards::ZoneChangedContext const& context) {
+				CombinedEvent::AddedToHandZone::Invoke(context);
+			};
 		}
 	};
 
@@ -35,7 +35,7 @@ namespace Cards
 	struct Card_EX1_160be : public Enchantment<Card_EX1_160be, Attack<1>, MaxHP<1>> {};
 	struct Card_EX1_160 : public SpellCardBase<Card_EX1_160> {
 		Card_EX1_160() {
-			static std::vector<Cards::CardId> choices{
+			static engine::FlowControl::CardIdChoices choices{
 				Cards::ID_EX1_160a,
 				Cards::ID_EX1_160b
 			};
@@ -56,7 +56,7 @@ namespace Cards
 
 	struct Card_EX1_154 : public SpellCardBase<Card_EX1_154> {
 		Card_EX1_154() {
-			static std::vector<Cards::CardId> choices{
+			static engine::FlowControl::CardIdChoices choices{
 				Cards::ID_EX1_154a,
 				Cards::ID_EX1_154b
 			};
@@ -80,7 +80,7 @@ namespace Cards
 	struct Card_EX1_155be : public Enchantment<Card_EX1_155be, MaxHP<4>> {};
 	struct Card_EX1_155 : public SpellCardBase<Card_EX1_155> {
 		Card_EX1_155() {
-			static std::vector<Cards::CardId> choices{
+			static engine::FlowControl::CardIdChoices choices{
 				Cards::ID_EX1_155a,
 				Cards::ID_EX1_155b
 			};
@@ -131,7 +131,7 @@ namespace Cards
 			state::CardRef target = context.GetTarget();
 			if (!target.IsValid()) return;
 
-			static std::vector<Cards::CardId> choices{
+			static engine::FlowControl::CardIdChoices choices{
 				Cards::ID_EX1_166a,
 				Cards::ID_EX1_166b
 			};
@@ -157,7 +157,7 @@ namespace Cards
 
 	struct Card_EX1_164 : public SpellCardBase<Card_EX1_164> {
 		Card_EX1_164() {
-			static std::vector<Cards::CardId> choices{
+			static engine::FlowControl::CardIdChoices choices{
 				Cards::ID_EX1_164a,
 				Cards::ID_EX1_164b
 			};
@@ -177,7 +177,7 @@ namespace Cards
 
 	struct Card_NEW1_007 : public SpellCardBase<Card_NEW1_007> {
 		Card_NEW1_007() {
-			static std::vector<Cards::CardId> choices{
+			static engine::FlowControl::CardIdChoices choices{
 				Cards::ID_NEW1_007a,
 				Cards::ID_NEW1_007b,
 			};
@@ -213,11 +213,11 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_165t1 : public MinionCardBase<Card_EX1_165t1, Charge> {};
-	struct Card_EX1_165t2 : public MinionCardBase<Card_EX1_165t2, Taunt> {};
+	struct Card_EX1_165t1 : public VanillaMinionCardBase<Card_EX1_165t1, Charge> {};
+	struct Card_EX1_165t2 : public VanillaMinionCardBase<Card_EX1_165t2, Taunt> {};
 	struct Card_EX1_165 : public MinionCardBase<Card_EX1_165> {
 		static void Battlecry(Contexts::OnPlay const& context) {
-			static std::vector<Cards::CardId> choices{
+			static engine::FlowControl::CardIdChoices choices{
 				Cards::ID_EX1_165a,
 				Cards::ID_EX1_165b
 			};
@@ -236,7 +236,7 @@ namespace Cards
 
 	struct Card_NEW1_008 : public MinionCardBase<Card_NEW1_008> {
 		Card_NEW1_008() {
-			static std::vector<Cards::CardId> choices{
+			static engine::FlowControl::CardIdChoices choices{
 				Cards::ID_NEW1_008a,
 				Cards::ID_NEW1_008b
 			};
@@ -273,7 +273,7 @@ namespace Cards
 	struct Card_EX1_178be : public Enchantment<Card_EX1_178be, Attack<5>> {};
 	struct Card_EX1_178 : public MinionCardBase<Card_EX1_178> {
 		static void Battlecry(Contexts::OnPlay const& context) {
-			static std::vector<Cards::CardId> choices{
+			static engine::FlowControl::CardIdChoices choices{
 				Cards::ID_EX1_178a,
 				Cards::ID_EX1_178b
 			};
@@ -289,10 +289,10 @@ namespace Cards
 	};
 
 	struct Card_EX1_573ae : public Enchantment<Card_EX1_573ae, MaxHP<2>, Attack<2>> {};
-	struct Card_EX1_573t : public MinionCardBase<Card_EX1_573t, Taunt> {};
+	struct Card_EX1_573t : public VanillaMinionCardBase<Card_EX1_573t, Taunt> {};
 	struct Card_EX1_573 : public MinionCardBase<Card_EX1_573> {
 		static void Battlecry(Contexts::OnPlay const& context) {
-			static std::vector<Cards::CardId> choices{
+			static engine::FlowControl::CardIdChoices choices{
 				Cards::ID_EX1_573a,
 				Cards::ID_EX1_573b
 			};
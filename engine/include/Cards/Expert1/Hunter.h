@@ -160,7 +160,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_538t : public MinionCardBase<Card_EX1_538t, Charge> {};
+	struct Card_EX1_538t : public VanillaMinionCardBase<Card_EX1_538t, Charge> {};
 	struct Card_EX1_538 : public SpellCardBase<Card_EX1_538> {
 		Card_EX1_538() {
 			onplay_handler.SetCheckPlayableCallback([](Contexts::CheckPlayable & context) {
@@ -231,7 +231,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_543 : public MinionCardBase<Card_EX1_543, Charge> {};
+	struct Card_EX1_543 : public VanillaMinionCardBase<Card_EX1_543, Charge> {};
 }
 
 REGISTER_CARD(EX1_543)
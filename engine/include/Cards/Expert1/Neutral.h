@@ -26,7 +26,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_008 : public MinionCardBase<Card_EX1_008, Shield> {};
+	struct Card_EX1_008 : public VanillaMinionCardBase<Card_EX1_008, Shield> {};
 
 	struct Card_NEW1_025 : public MinionCardBase<Card_NEW1_025> {
 		static void Battlecry(Contexts::OnPlay const& context) {
@@ -101,7 +101,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_405 : public MinionCardBase<Card_EX1_405, Taunt> {};
+	struct Card_EX1_405 : public VanillaMinionCardBase<Card_EX1_405, Taunt> {};
 
 	struct Card_CS2_146o : public Enchantment<Card_CS2_146o, Charge> {};
 	struct Card_CS2_146 : public MinionCardBase<Card_CS2_146> {
@@ -115,8 +115,8 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_010 : public MinionCardBase<Card_EX1_010, Stealth> {};
-	struct Card_CS2_169 : public MinionCardBase<Card_CS2_169, Windfury> {};
+	struct Card_EX1_010 : public VanillaMinionCardBase<Card_EX1_010, Stealth> {};
+	struct Card_CS2_169 : public VanillaMinionCardBase<Card_CS2_169, Windfury> {};
 	
 	struct Card_EX1_004e : public Enchantment<Card_EX1_004e, MaxHP<1>> {};
 	struct Card_EX1_004 : public MinionCardBase<Card_EX1_004> {
@@ -146,7 +146,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_045 : public MinionCardBase<Card_EX1_045, CantAttack> {};
+	struct Card_EX1_045 : public VanillaMinionCardBase<Card_EX1_045, CantAttack> {};
 	struct Card_EX1_012 : public MinionCardBase<Card_EX1_012, SpellDamage<1>> {
 		Card_EX1_012() {
 			deathrattle_handler.Add([](engine::FlowControl::deathrattle::context::Deathrattle const& context) {
@@ -211,7 +211,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_NEW1_023 : public MinionCardBase<Card_NEW1_023, ImmuneToSpellAndHeroPower> {};
+	struct Card_NEW1_023 : public VanillaMinionCardBase<Card_NEW1_023, ImmuneToSpellAndHeroPower> {};
 
 	struct Card_NEW1_019 : public MinionCardBase<Card_NEW1_019> {
 		static bool HandleEvent(state::CardRef self, state::Events::EventTypes::AfterMinionSummoned::Context const& context) {
@@ -425,7 +425,7 @@ namespace Cards
 			state::PlayerIdentifier player = context.manipulate_.GetCard(self).GetPlayerIdentifier();
 			if (context.manipulate_.Board().GetCurrentPlayerId() != player) return true;
 
-			std::vector<state::CardRef> candidates;
+			Utils::FixedCapacityVector<state::CardRef, state::board::Hand::max_cards_> candidates;
 			context.manipulate_.Board().Player(player).hand_.ForEach([&](state::CardRef ref) {
 				if (context.manipulate_.GetCard(ref).GetCardType() != state::kCardTypeMinion) return true;
 				candidates.push_back(ref);
@@ -523,7 +523,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_170 : public MinionCardBase<Card_EX1_170, Poisonous> {};
+	struct Card_EX1_170 : public VanillaMinionCardBase<Card_EX1_170, Poisonous> {};
 
 	struct Card_tt_004o : public Enchantment<Card_tt_004o, Attack<1>> {};
 	struct Card_tt_004 : public MinionCardBase<Card_tt_004> {
@@ -576,7 +576,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_017 : public MinionCardBase<Card_EX1_017, Stealth> {};
+	struct Card_EX1_017 : public VanillaMinionCardBase<Card_EX1_017, Stealth> {};
 
 	struct Card_EX1_014te : public Enchantment<Card_EX1_014te, Attack<1>, MaxHP<1>> {};
 	struct Card_EX1_014t : public SpellCardBase<Card_EX1_014t> {
@@ -646,7 +646,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_020 : public MinionCardBase<Card_EX1_020, Shield> {};
+	struct Card_EX1_020 : public VanillaMinionCardBase<Card_EX1_020, Shield> {};
 
 	struct Card_NEW1_027e : public Enchantment<Card_NEW1_027e, Attack<1>, MaxHP<1>> {};
 	struct Card_NEW1_027 : public MinionCardBase<Card_NEW1_027> {
@@ -672,7 +672,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_021 : public MinionCardBase<Card_EX1_021, Windfury> {};
+	struct Card_EX1_021 : public VanillaMinionCardBase<Card_EX1_021, Windfury> {};
 
 	struct Card_EX1_083 : public MinionCardBase<Card_EX1_083> {
 		static void Battlecry(Contexts::OnPlay const& context) {
@@ -759,8 +759,8 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_396 : public MinionCardBase<Card_EX1_396, Taunt> {};
-	struct Card_EX1_023 : public MinionCardBase<Card_EX1_023, Shield> {};
+	struct Card_EX1_396 : public VanillaMinionCardBase<Card_EX1_396, Taunt> {};
+	struct Card_EX1_023 : public VanillaMinionCardBase<Card_EX1_023, Shield> {};
 
 	struct Card_EX1_048 : public MinionCardBase<Card_EX1_048> {
 		static void GetSpecifiedTargets(Contexts::SpecifiedTargetGetter & context) {
@@ -844,7 +844,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_CS1_069 : public MinionCardBase<Card_CS1_069, Taunt> {};
+	struct Card_CS1_069 : public VanillaMinionCardBase<Card_CS1_069, Taunt> {};
 
 	struct Card_EX1_558 : public MinionCardBase<Card_EX1_558> {
 		static void Battlecry(Contexts::OnPlay const& context) {
@@ -892,7 +892,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_028 : public MinionCardBase<Card_EX1_028, Stealth> {};
+	struct Card_EX1_028 : public VanillaMinionCardBase<Card_EX1_028, Stealth> {};
 
 	struct Card_CS2_227 : public MinionCardBase<Card_CS2_227> {
 		static bool HandleEvent(state::CardRef self, state::Events::EventTypes::GetPlayCardCost::Context const& context) {
@@ -907,7 +907,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_067 : public MinionCardBase<Card_EX1_067, Charge, Shield> {};
+	struct Card_EX1_067 : public VanillaMinionCardBase<Card_EX1_067, Charge, Shield> {};
 
 	struct Card_EX1_110 : public MinionCardBase<Card_EX1_110> {
 		Card_EX1_110() {
@@ -941,7 +941,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_NEW1_040t : public MinionCardBase<Card_NEW1_040t, Taunt> {};
+	struct Card_NEW1_040t : public VanillaMinionCardBase<Card_NEW1_040t, Taunt> {};
 	struct Card_NEW1_040 : public MinionCardBase<Card_NEW1_040> {
 		static bool HandleEvent(state::CardRef self, state::Events::EventTypes::OnTurnEnd::Context const& context) {
 			SummonToRight(context.manipulate_, self, Cards::ID_NEW1_040t);
@@ -970,7 +970,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_032 : public MinionCardBase<Card_EX1_032, Taunt, Shield> {};
+	struct Card_EX1_032 : public VanillaMinionCardBase<Card_EX1_032, Taunt, Shield> {};
 
 	struct Card_EX1_577 : public MinionCardBase<Card_EX1_577> {
 		Card_EX1_577() {
@@ -991,7 +991,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_EX1_033 : public MinionCardBase<Card_EX1_033, Windfury> {};
+	struct Card_EX1_033 : public VanillaMinionCardBase<Card_EX1_033, Windfury> {};
 
 	struct Card_EX1_249 : public MinionCardBase<Card_EX1_249> {
 		static bool HandleEvent(state::CardRef self, state::Events::EventTypes::OnTurnEnd::Context const& context) {
@@ -1012,7 +1012,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_CS2_161 : public MinionCardBase<Card_CS2_161, Stealth> {};
+	struct Card_CS2_161 : public VanillaMinionCardBase<Card_CS2_161, Stealth> {};
 
 	struct Card_NEW1_038_Enchant : public Enchantment<Card_NEW1_038_Enchant, Attack<1>, MaxHP<1>> {};
 	struct Card_NEW1_038 : public MinionCardBase<Card_NEW1_038> {
@@ -1052,7 +1052,7 @@ namespace Cards
 		}
 	};
 
-	struct Card_DREAM_01 : public MinionCardBase<Card_DREAM_01, ImmuneToSpellAndHeroPower> {};
+	struct Card_DREAM_01 : public VanillaMinionCardBase<Card_DREAM_01, ImmuneToSpellAndHeroPower> {};
 	struct Card_DREAM_02 : public SpellCardBase<Card_DREAM_02> {
 		Card_DREAM_02() {
 			onplay_handler.SetOnPlayCallback([](engine::FlowControl::onplay::context::OnPlay const& context) {
@@ -180,8 +180,8 @@ namespace Cards
 				Cards::CardId drawn_card_id = kInvalidCardId;
 				context.manipulate_.Player(context.player_).DrawCard(&drawn_card_id);
 				if (!IsValidCardId(drawn_card_id)) return;
-				state::Cards::CardData raw_card = Cards::CardDispatcher::CreateInstance(drawn_card_id);
-				context.manipulate_.OnBoardCharacter(target).Damage(context.card_ref_, raw_card.enchanted_states.cost);
+				int cost = Cards::CardDispatcher::GetPrototype(drawn_card_id, context.player_).GetCost();
+				context.manipulate_.OnBoardCharacter(target).Damage(context.card_ref_, cost);
 			});
 		}
 	};
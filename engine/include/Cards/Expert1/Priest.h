@@ -139,9 +139,9 @@ namespace Cards
 				return true;
 			});
 			onplay_handler.SetOnPlayCallback([](engine::FlowControl::onplay::context::OnPlay const& context) {
-				std::vector<Cards::CardId> possibles;
+				Utils::FixedCapacityVector<Cards::CardId, state::board::Deck::max_size> possibles;
 				context.manipulate_.Board().Player(context.player_).deck_.ForEach([&](Cards::CardId in_card_id) {
-					if (Cards::CardDispatcher::CreateInstance(in_card_id).card_type == state::kCardTypeMinion) {
+					if (Cards::CardDispatcher::GetPrototype(in_card_id, context.player_).GetCardType() == state::kCardTypeMinion) {
 						possibles.push_back(in_card_id);
 					}
 					return true;
@@ -198,9 +198,9 @@ namespace Cards
 	struct Card_EX1_335o : EnchantmentCardBase {
 		static constexpr EnchantmentTiers aura_tier = EnchantmentTiers::kEnchantmentTier3; // always apply at the last stage
 		Card_EX1_335o() {
-			apply_functor = [](engine::FlowControl::enchantment::Enchantments::ApplyFunctorContext const& context) {
+			Utils::CodeRegistry::Bind(apply_functor, [](engine::FlowControl::enchantment::Enchantments::ApplyFunctorContext const& context) {
 				context.stats_->attack = context.state_.GetCard(context.card_ref_).GetHP();
-			};
+			});
 			force_update_every_time = true;
 		}
 	};
@@ -63,9 +63,9 @@ namespace Cards
 	struct Card_EX1_317 : SpellCardBase<Card_EX1_317> {
 		Card_EX1_317() {
 			onplay_handler.SetOnPlayCallback([](engine::FlowControl::onplay::context::OnPlay const& context) {
-				std::vector<Cards::CardId> possibles;
+				Utils::FixedCapacityVector<Cards::CardId, state::board::Deck::max_size> possibles;
 				context.manipulate_.Board().Player(context.player_).deck_.ForEach([&](Cards::CardId in_card_id) {
-					if (Cards::CardDispatcher::CreateInstance(in_card_id).card_race == state::kCardRaceDemon) {
+					if (Cards::CardDispatcher::GetPrototype(in_card_id, context.player_).GetRace() == state::kCardRaceDemon) {
 						possibles.push_back(in_card_id);
 					}
 					return true;
@@ -144,10 +144,10 @@ namespace Cards
 	struct Card_EX1_315o : Enchantment<Card_EX1_315o> {
 		static constexpr EnchantmentTiers aura_tier = EnchantmentTiers::kEnchantmentTier3; // always apply at the last stage
 		Card_EX1_315o() {
-			apply_functor = [](engine::FlowControl::enchantment::Enchantments::ApplyFunctorContext const& context) {
+			Utils::CodeRegistry::Bind(apply_functor, [](engine::FlowControl::enchantment::Enchantments::ApplyFunctorContext const& context) {
 				context.stats_->cost -= 2;
 				if (context.stats_->cost <= 0) context.stats_->cost = 1;
-			};
+			});
 		}
 	};
 	struct Card_EX1_315 : MinionCardBase<Card_EX1_315> {
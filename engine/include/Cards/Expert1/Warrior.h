@@ -73,7 +73,7 @@ namespace Cards
 				state::PlayerIdentifier player = context.player_;
 				int turn = context.manipulate_.Board().GetTurn();
 				context.manipulate_.AddEvent<state::Events::EventTypes::OnTakeDamage>(
-					[&](state::Events::EventTypes::OnTakeDamage::Context const& context) {
+					[turn, player](state::Events::EventTypes::OnTakeDamage::Context const& context) {
 					if (context.manipulate_.Board().GetTurn() != turn) return false;
 
 					auto const& card = context.manipulate_.GetCard(context.card_ref_);
@@ -1,13 +1,22 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <vector>
 
 #include "Cards/Database.h"
 #include "Cards/id-map.h"
+#include "Cards/CardIdSet.h"
 #include "Cards/CardDispatcher.h"
+#include "state/Cards/Card.h"
 
 namespace Cards
 {
+	// Card pools for the effects generating random cards
+	// Each dimension (cost, class, type, race, set, and a few flags) is indexed as a CardIdSet,
+	//    so a pool is the intersection of a few sets, e.g.,
+	//       GetCollectibles() & GetByType(kCardTypeMinion) & GetByCost(3)
+	// The frequently used pools are also kept as arrays (see IndexedType).
 	class PreIndexedCards
 	{
 	public:
@@ -18,52 +27,88 @@ namespace Cards
 			kCachedCardsTypesCount // should be at last
 		};
 
+		static constexpr int kMaxIndexedCost = 12; // cards costing more share the set with this cost
+
 		static PreIndexedCards & GetInstance() {
 			static PreIndexedCards instance;
 			return instance;
 		}
 
 		void Initialize() {
+			*this = PreIndexedCards();
+
 			Database::GetInstance().ForEachCard([&](Database::CardData const& card) {
 				ProcessCachedCardsTypes(card);
 				return true;
 			});
+
+			FillIndexedCards(kCollectibles, collectibles_);
+			FillIndexedCards(kMinionDemons, by_type_[state::kCardTypeMinion] & by_race_[state::kCardRaceDemon]);
+			FillIndexedCards(kMinionTaunt, by_type_[state::kCardTypeMinion] & taunt_);
 		}
 
 		std::vector<int> const& GetIndexedCards(IndexedType type) {
 			return indexed_cards_[type];
 		}
 
+	public: // pools
+		CardIdSet const& GetAllCards() const { return all_; }
+		CardIdSet const& GetCollectibles() const { return collectibles_; }
+		CardIdSet const& GetTaunt() const { return taunt_; }
+
+		CardIdSet const& GetByCost(int cost) const {
+			assert(cost >= 0);
+			return by_cost_[cost < kMaxIndexedCost ? cost : kMaxIndexedCost];
+		}
+		CardIdSet const& GetByClass(state::PlayerClass player_class) const { return by_class_[player_class]; }
+		CardIdSet const& GetByType(state::CardType card_type) const { return by_type_[card_type]; }
+		CardIdSet const& GetByRace(state::CardRace card_race) const { return by_race_[card_race]; }
+		CardIdSet const& GetBySet(state::CardSet card_set) const { return by_set_[card_set]; }
+
 	private:
-		PreIndexedCards() : indexed_cards_() {}
+		PreIndexedCards() :
+			indexed_cards_(), all_(), collectibles_(), taunt_(),
+			by_cost_(), by_class_(), by_type_(), by_race_(), by_set_()
+		{}
 
 		void ProcessCachedCardsTypes(Database::CardData const& new_card) {
-			state::Cards::CardData card_data;
+			state::Cards::Card const* card = nullptr;
 			try {
-				card_data = CardDispatcher::CreateInstance((CardId)new_card.card_id);
+				card = &CardDispatcher::GetPrototype((CardId)new_card.card_id, state::PlayerIdentifier::First());
 			}
 			catch (std::exception const&) {
 				return;
 			}
 
-			if (new_card.collectible) {
-				indexed_cards_[kCollectibles].push_back(new_card.card_id);
-			}
+			CardId const card_id = (CardId)new_card.card_id;
+			all_.Add(card_id);
+			if (new_card.collectible) collectibles_.Add(card_id);
+			if (card->HasTaunt()) taunt_.Add(card_id);
 
-			if (new_card.card_race == state::kCardRaceDemon &&
-				new_card.card_type == state::kCardTypeMinion)
-			{
-				indexed_cards_[kMinionDemons].push_back(new_card.card_id);
-			}
+			by_cost_[std::min(std::max(new_card.cost, 0), kMaxIndexedCost)].Add(card_id);
+			by_class_[new_card.player_class].Add(card_id);
+			by_type_[new_card.card_type].Add(card_id);
+			by_race_[new_card.card_race].Add(card_id);
+			by_set_[new_card.card_set].Add(card_id);
+		}
 
-			if (new_card.card_type == state::kCardTypeMinion &&
-				card_data.taunt)
-			{
-				indexed_cards_[kMinionTaunt].push_back(new_card.card_id);
-			}
+		void FillIndexedCards(IndexedType type, CardIdSet const& cards) {
+			cards.ForEach([&](CardId card_id) {
+				indexed_cards_[type].push_back((int)card_id);
+				return true;
+			});
 		}
 
 	private:
 		std::array<std::vector<int>, kCachedCardsTypesCount> indexed_cards_;
+
+		CardIdSet all_;
+		CardIdSet collectibles_;
+		CardIdSet taunt_;
+		std::array<CardIdSet, kMaxIndexedCost + 1> by_cost_;
+		std::array<CardIdSet, state::kPlayerClassInvalid + 1> by_class_;
+		std::array<CardIdSet, state::kCardTypeEnchantment + 1> by_type_;
+		std::array<CardIdSet, state::kCardRaceOrc + 1> by_race_;
+		std::array<CardIdSet, state::kCardSetTB + 1> by_set_;
 	};
-}
\ No newline at end of file
+}
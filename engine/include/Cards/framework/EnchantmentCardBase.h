@@ -53,13 +53,13 @@ namespace Cards
 			// Since, the Enchant concept has the 'tier_if_aura' field, we use it to detect misuse
 			static_assert(detail::HasTierIfAura<T>::value == false);
 
-			apply_functor = [](engine::FlowControl::enchantment::Enchantments::ApplyFunctorContext const& context) {
+			Utils::CodeRegistry::Bind(apply_functor, [](engine::FlowControl::enchantment::Enchantments::ApplyFunctorContext const& context) {
 				Enchant1::Apply(*context.stats_);
 				Enchant2::Apply(*context.stats_);
 				Enchant3::Apply(*context.stats_);
 				Enchant4::Apply(*context.stats_);
 				Enchant5::Apply(*context.stats_);
-			};
+			});
 		}
 	};
 
@@ -116,15 +116,15 @@ namespace Cards
 			// Since, the Enchant concept has the 'tier_if_aura' field, we use it to detect misuse
 			static_assert(detail::HasTierIfAura<T>::value == false);
 
-			apply_functor = [](engine::FlowControl::enchantment::Enchantments::ApplyFunctorContext const& context) {
+			Utils::CodeRegistry::Bind(apply_functor, [](engine::FlowControl::enchantment::Enchantments::ApplyFunctorContext const& context) {
 				Enchant1::Apply(*context.stats_);
 				Enchant2::Apply(*context.stats_);
 				Enchant3::Apply(*context.stats_);
 				Enchant4::Apply(*context.stats_);
 				Enchant5::Apply(*context.stats_);
-			};
+			});
 
-			register_functor = [](engine::FlowControl::Manipulate const& manipulate, state::CardRef card_ref,
+			Utils::CodeRegistry::Bind(register_functor, [](engine::FlowControl::Manipulate const& manipulate, state::CardRef card_ref,
 					engine::FlowControl::enchantment::Enchantments::IdentifierType id,
 					engine::FlowControl::enchantment::Enchantments::EventHookedEnchantment::AuxData & aux_data)
 			{
@@ -136,7 +136,7 @@ namespace Cards
 					T::HandleEvent(EventHookedEnchantmentHandler<T>(card_ref, id, context, aux_data));
 					return true;
 				});
-			};
+			});
 		}
 
 		engine::FlowControl::enchantment::Enchantments::ApplyFunctor apply_functor;
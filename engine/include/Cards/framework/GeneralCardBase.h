@@ -189,7 +189,7 @@ namespace Cards
 			std::array<int, 3> choice_indics = GetAtMostRandomThreeNumbers(manipulate, (int)container.size());
 			size_t choice_indics_size = std::min(container.size(), (size_t)3);
 
-			std::vector<Cards::CardId> choices;
+			engine::FlowControl::CardIdChoices choices;
 			for (size_t i = 0; i < choice_indics_size; ++i) {
 				choices.push_back((Cards::CardId)container[choice_indics[i]]);
 			}
@@ -198,6 +198,29 @@ namespace Cards
 			return manipulate.UserChooseOne(choices);
 		}
 
+		// 'cards' is usually made of the pools in PreIndexedCards
+		static Cards::CardId GetRandomCardFromDatabase(engine::FlowControl::Manipulate const& manipulate, CardIdSet const& cards) {
+			int count = cards.Count();
+			if (count == 0) return kInvalidCardId;
+			return cards.Get(manipulate.GetRandom().Get(count));
+		}
+
+		static Cards::CardId DiscoverFromDatabase(engine::FlowControl::Manipulate const& manipulate, CardIdSet const& cards) {
+			int count = cards.Count();
+			assert(count > 0);
+
+			std::array<int, 3> choice_indics = GetAtMostRandomThreeNumbers(manipulate, count);
+			int choice_indics_size = std::min(count, 3);
+
+			engine::FlowControl::CardIdChoices choices;
+			for (int i = 0; i < choice_indics_size; ++i) {
+				choices.push_back(cards.Get(choice_indics[i]));
+			}
+
+			assert(!choices.empty());
+			return manipulate.UserChooseOne(choices);
+		}
+
 	private:
 		static state::CardRef SummonInternal(engine::FlowControl::Manipulate const& manipulate, Cards::CardId card_id, state::PlayerIdentifier player, int pos)
 		{
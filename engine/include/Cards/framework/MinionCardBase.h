@@ -31,4 +31,17 @@ namespace Cards
 		template <typename Types>
 		auto AdjacentBuffAura() { return AdjacentBuffHelper<T, Types>(*this); }
 	};
+
+	// A minion card having only its attributes (e.g., Taunt); declares CardTraits::kVanilla
+	template <typename T, typename... Ts>
+		class VanillaMinionCardBase : public MinionCardBase<T, Ts...>
+	{
+	public:
+		static constexpr bool kVanilla = true;
+
+		VanillaMinionCardBase() {
+			static_assert(!detail::HasBattlecry<T>::value);
+			static_assert(!detail::HasGetSpecifiedTargets<T>::value);
+		}
+	};
 }
\ No newline at end of file
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "Utils/CodeRegistry.h"
+
+// A compact binary archive; see state::BinarySerializer
+// The classes to be archived provide
+//    template <typename Writer> void Save(Writer & writer) const;
+//    template <typename Reader> void Load(Reader & reader);
+// Values are written in the native byte order, so the data can only be read on the same platform.
+
+namespace Utils
+{
+	namespace detail
+	{
+		template <typename T>
+		constexpr bool IsCodePointer = std::is_pointer_v<T> && std::is_function_v<std::remove_pointer_t<T>>;
+	}
+
+	class BinaryWriter
+	{
+	public:
+		// The data is appended to 'buffer'
+		// The buffer grows in large steps, and it is trimmed to the written size when the writer is destroyed
+		explicit BinaryWriter(std::vector<uint8_t> & buffer) : buffer_(buffer), size_(buffer.size()) {}
+
+		~BinaryWriter() { buffer_.resize(size_); }
+
+		BinaryWriter(BinaryWriter const&) = delete;
+		BinaryWriter & operator=(BinaryWriter const&) = delete;
+
+		// Pointer-free, trivially-copyable values only
+		template <typename T>
+		void WriteRaw(T const& value) {
+			static_assert(std::is_trivially_copyable_v<T>);
+			static_assert(!std::is_pointer_v<T>);
+			if (buffer_.size() - size_ < sizeof(T)) Grow(sizeof(T));
+			memcpy(buffer_.data() + size_, &value, sizeof(T));
+			size_ += sizeof(T);
+		}
+
+		void WriteSize(size_t size) {
+			assert(size <= UINT32_MAX);
+			WriteRaw((uint32_t)size);
+		}
+
+		void WriteBytes(void const* data, size_t size) {
+			if (buffer_.size() - size_ < size) Grow(size);
+			memcpy(buffer_.data() + size_, data, size);
+			size_ += size;
+		}
+
+		// Written as the id in Utils::CodeRegistry
+		template <typename FuncPtr>
+		void WriteCodePointer(FuncPtr ptr) {
+			static_assert(detail::IsCodePointer<FuncPtr>);
+			WriteRaw(CodeRegistry::GetId(ptr));
+		}
+
+		// A code pointer, or a class with a Save() method
+		template <typename T>
+		void Write(T const& value) {
+			if constexpr (detail::IsCodePointer<T>) WriteCodePointer(value);
+			else value.Save(*this);
+		}
+
+	private:
+		void Grow(size_t bytes) {
+			size_t new_size = std::max(buffer_.capacity(), buffer_.size() * 2);
+			new_size = std::max(new_size, size_ + bytes);
+			new_size = std::max(new_size, (size_t)4096);
+			buffer_.resize(new_size);
+		}
+
+	private:
+		std::vector<uint8_t> & buffer_;
+		size_t size_;
+	};
+
+	// Throws std::runtime_error if the data is truncated or malformed, or if a code pointer is unknown
+	class BinaryReader
+	{
+	public:
+		BinaryReader(uint8_t const* data, size_t size) : data_(data), remaining_(size) {}
+
+		BinaryReader(BinaryReader const&) = delete;
+		BinaryReader & operator=(BinaryReader const&) = delete;
+
+		template <typename T>
+		void ReadRaw(T & value) {
+			static_assert(std::is_trivially_copyable_v<T>);
+			static_assert(!std::is_pointer_v<T>);
+			if (remaining_ < sizeof(T)) throw std::runtime_error("binary data is truncated");
+			memcpy(&value, data_, sizeof(T));
+			data_ += sizeof(T);
+			remaining_ -= sizeof(T);
+		}
+
+		// Each item takes at least one byte, so a size larger than the remaining data is malformed
+		size_t ReadSize(size_t max_size = SIZE_MAX) {
+			uint32_t size;
+			ReadRaw(size);
+			if (size > max_size || size > remaining_) throw std::runtime_error("binary data is malformed");
+			return size;
+		}
+
+		void ReadBytes(void * data, size_t size) {
+			if (remaining_ < size) throw std::runtime_error("binary data is truncated");
+			memcpy(data, data_, size);
+			data_ += size;
+			remaining_ -= size;
+		}
+
+		template <typename FuncPtr>
+		void ReadCodePointer(FuncPtr & ptr) {
+			static_assert(detail::IsCodePointer<FuncPtr>);
+			CodeRegistry::IdType id;
+			ReadRaw(id);
+			ptr = CodeRegistry::Get<FuncPtr>(id);
+		}
+
+		template <typename T>
+		void Read(T & value) {
+			if constexpr (detail::IsCodePointer<T>) ReadCodePointer(value);
+			else value.Load(*this);
+		}
+
+		void Check(bool valid) {
+			if (!valid) throw std::runtime_error("binary data is malformed");
+		}
+
+		bool AtEnd() const { return remaining_ == 0; }
+
+	private:
+		uint8_t const* data_;
+		size_t remaining_;
+	};
+}
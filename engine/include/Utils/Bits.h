@@ -0,0 +1,56 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+
+namespace Utils
+{
+	inline int PopCount(uint32_t v) {
+#ifdef __GNUC__
+		return __builtin_popcount(v);
+#else
+		v = v - ((v >> 1) & 0x55555555);
+		v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
+		return (int)((((v + (v >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24);
+#endif
+	}
+
+	// 'v' should not be zero
+	inline int CountTrailingZeros(uint32_t v) {
+		assert(v != 0);
+#ifdef __GNUC__
+		return __builtin_ctz(v);
+#else
+		int n = 0;
+		while ((v & 1) == 0) {
+			v >>= 1;
+			++n;
+		}
+		return n;
+#endif
+	}
+
+	// The position of the n-th (zero-based) set bit
+	inline int SelectBit(uint32_t v, int n) {
+		assert(n >= 0 && n < PopCount(v));
+		for (int i = 0; i < n; ++i) v &= v - 1; // clear the lowest set bit
+		return CountTrailingZeros(v);
+	}
+
+	inline int PopCount(uint64_t v) {
+		return PopCount((uint32_t)v) + PopCount((uint32_t)(v >> 32));
+	}
+
+	// 'v' should not be zero
+	inline int CountTrailingZeros(uint64_t v) {
+		assert(v != 0);
+		if ((uint32_t)v) return CountTrailingZeros((uint32_t)v);
+		return 32 + CountTrailingZeros((uint32_t)(v >> 32));
+	}
+
+	inline int SelectBit(uint64_t v, int n) {
+		int const low_count = PopCount((uint32_t)v);
+		if (n < low_count) return SelectBit((uint32_t)v, n);
+		return 32 + SelectBit((uint32_t)(v >> 32), n - low_count);
+	}
+}
@@ -118,6 +118,37 @@ namespace Utils
 				first_possible_exist_id_ = items_.GetNextPushBackItemIdentifier();
 			}
 
+		public: // archive
+			// The removed items are kept, so the identifiers are still valid after loaded
+			// ItemSaver: void(Writer &, ItemType const&)
+			template <typename Writer, typename ItemSaver>
+			void Save(Writer & writer, ItemSaver && item_saver) const {
+				writer.WriteSize(items_.Size());
+				for (size_t idx = 0; idx < items_.Size(); ++idx) {
+					InternalItemType const& item = items_.Get(items_.GetIdentifier(idx));
+					writer.WriteRaw(item.removed);
+					writer.WriteRaw(item.next_possible_exist_id);
+					item_saver(writer, item.item);
+				}
+				writer.WriteRaw(first_possible_exist_id_);
+			}
+
+			// ItemLoader: ItemType(Reader &)
+			template <typename Reader, typename ItemLoader>
+			void Load(Reader & reader, ItemLoader && item_loader) {
+				items_.Reset();
+				size_t size = reader.ReadSize();
+				for (size_t idx = 0; idx < size; ++idx) {
+					bool removed;
+					VectorIdentifier next_possible_exist_id;
+					reader.ReadRaw(removed);
+					reader.ReadRaw(next_possible_exist_id);
+					auto id = items_.PushBack(InternalItemType(item_loader(reader), next_possible_exist_id));
+					items_.Get(id).removed = removed;
+				}
+				reader.ReadRaw(first_possible_exist_id_);
+			}
+
 		public: // iterate
 			// Only iterate through exist items
 			template <typename IterateCallback> // bool(ItemType&), return true to continue; false to abort
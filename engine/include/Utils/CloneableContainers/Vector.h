@@ -88,6 +88,7 @@ namespace Utils
 			Identifier GetBegin() const { return Identifier(0); }
 			void StepNext(Identifier & id) const { ++id.idx; }
 			Identifier GetEnd() const { return Identifier((int)items_.size()); }
+			Identifier GetIdentifier(size_t idx) const { return Identifier((int)idx); }
 
 			template <typename IterateCallback> // bool(ItemType&), return true to continue; false to abort
 			void IterateAll(IterateCallback&& callback) {
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdexcept>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+namespace Utils
+{
+	// Gives the callbacks kept in a state (e.g., the battlecry of a card) a stable id, so they can be
+	//    archived (see Utils::BinaryWriter), and the id can be resolved back in another process.
+	// The id is a hash of the (mangled) type name of the callable, so it does not depend on the code
+	//    layout; it is kept as long as the callable is not renamed or moved.
+	// The callables are registered during static initialization, so a process can resolve an id before
+	//    it creates the callback by itself. Thus, the callback should be set through Bind(), rather than
+	//    by assigning a function pointer.
+	class CodeRegistry
+	{
+	public:
+		using IdType = uint64_t;
+		static constexpr IdType kNullId = 0;
+
+		// Sets 'code' to a captureless lambda (or another stateless callable)
+		template <typename Pointer, typename Functor>
+		static void Bind(Pointer & code, Functor const& functor) {
+			code = Bind<Pointer>(functor);
+		}
+
+		template <typename Pointer, typename Functor>
+		static Pointer Bind(Functor const& functor) {
+			static_assert(std::is_pointer_v<Pointer> && std::is_function_v<std::remove_pointer_t<Pointer>>);
+			static_assert(std::is_empty_v<Functor>, "Callback should be a captureless lambda");
+			Register<StatelessCode<Pointer, Functor>>();
+			return functor;
+		}
+
+		// Converts a callable to 'Target'; a code pointer is bound, and a Utils::TrivialFunction
+		//    registers its invoker by itself
+		template <typename Target, typename Functor>
+		static Target Make(Functor&& functor) {
+			if constexpr (std::is_pointer_v<Target> && std::is_function_v<std::remove_pointer_t<Target>>) {
+				return Bind<Target>(functor);
+			}
+			else {
+				return Target(std::forward<Functor>(functor));
+			}
+		}
+
+		// 'Source::Get()' returns the code pointer; the type name of 'Source' is the key
+		template <typename Source>
+		static void Register() {
+			(void)&Registrar<Source>::registered; // instantiates the registrar
+		}
+
+		// Throws std::runtime_error if the code is not registered
+		template <typename Pointer>
+		static IdType GetId(Pointer code) {
+			if (!code) return kNullId;
+			auto const& ids = GetTables().ids;
+			auto it = ids.find(reinterpret_cast<GenericCode>(code));
+			if (it == ids.end()) throw std::runtime_error("callback is not registered");
+			return it->second;
+		}
+
+		// Throws std::runtime_error if the id is unknown
+		template <typename Pointer>
+		static Pointer Get(IdType id) {
+			if (id == kNullId) return nullptr;
+			auto const& codes = GetTables().codes;
+			auto it = codes.find(id);
+			if (it == codes.end()) throw std::runtime_error("callback id is unknown");
+			return reinterpret_cast<Pointer>(it->second.code);
+		}
+
+	private:
+		using GenericCode = void(*)();
+
+		struct Entry {
+			char const* name;
+			GenericCode code;
+		};
+
+		struct Tables {
+			Tables() : codes(), ids() {}
+
+			std::unordered_map<IdType, Entry> codes;
+			std::unordered_map<GenericCode, IdType> ids;
+		};
+
+		template <typename Pointer, typename Functor>
+		struct StatelessCode {
+			// A stateless callable holds no data, so the bytes of an empty buffer stand for an instance
+			//    (as Utils::TrivialFunction does with its buffer)
+			static Pointer Get() {
+				alignas(Functor) static unsigned char const buffer[sizeof(Functor)] = {};
+				return *reinterpret_cast<Functor const*>(buffer);
+			}
+		};
+
+		template <typename Source>
+		struct Registrar;
+
+		static Tables & GetTables() {
+			static Tables tables; // constructed on first use, as the registrars run in an unspecified order
+			return tables;
+		}
+
+		// FNV-1a
+		static IdType HashName(char const* name) {
+			IdType hash = 14695981039346656037ull;
+			for (; *name; ++name) {
+				hash ^= (unsigned char)*name;
+				hash *= 1099511628211ull;
+			}
+			return hash == kNullId ? 1 : hash;
+		}
+
+		// The same callable might be registered from several modules (e.g., a shared library), with
+		//    different addresses; all of them are mapped to the id
+		static bool Add(char const* name, GenericCode code) {
+			Tables & tables = GetTables();
+			IdType id = HashName(name);
+			auto it = tables.codes.emplace(id, Entry{ name, code }).first;
+			if (strcmp(it->second.name, name) != 0) throw std::logic_error("callback id collides");
+			tables.ids.emplace(code, id);
+			return true;
+		}
+	};
+
+	template <typename Source>
+	struct CodeRegistry::Registrar {
+		static inline bool const registered = CodeRegistry::Add(typeid(Source).name(), reinterpret_cast<GenericCode>(Source::Get()));
+	};
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <array>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+namespace Utils
+{
+	// A vector-like container with inline storage; never allocates
+	// Items beyond size() are kept default-constructed, so copies are plain array copies
+	// Throws std::length_error if an item is added beyond the capacity (in release builds as well)
+	template <typename T, size_t Capacity>
+	class FixedCapacityVector
+	{
+	public:
+		typedef T value_type;
+		typedef T * iterator;
+		typedef T const* const_iterator;
+
+		FixedCapacityVector() : items_(), size_(0) {}
+
+		FixedCapacityVector(std::initializer_list<T> items) : items_(), size_(0) {
+			for (auto const& item : items) push_back(item);
+		}
+
+		size_t size() const { return size_; }
+		bool empty() const { return size_ == 0; }
+		static constexpr size_t capacity() { return Capacity; }
+
+		T const& operator[](size_t idx) const {
+			assert(idx < size_);
+			return items_[idx];
+		}
+		T & operator[](size_t idx) {
+			assert(idx < size_);
+			return items_[idx];
+		}
+
+		iterator begin() { return items_.data(); }
+		iterator end() { return items_.data() + size_; }
+		const_iterator begin() const { return items_.data(); }
+		const_iterator end() const { return items_.data() + size_; }
+
+		void push_back(T const& item) {
+			CheckCapacity();
+			items_[size_] = item;
+			++size_;
+		}
+
+		iterator insert(const_iterator pos, T const& item) {
+			CheckCapacity();
+			size_t idx = pos - begin();
+			assert(idx <= size_);
+			for (size_t i = size_; i > idx; --i) {
+				items_[i] = std::move(items_[i - 1]);
+			}
+			items_[idx] = item;
+			++size_;
+			return begin() + idx;
+		}
+
+		iterator erase(const_iterator pos) {
+			size_t idx = pos - begin();
+			assert(idx < size_);
+			for (size_t i = idx + 1; i < size_; ++i) {
+				items_[i - 1] = std::move(items_[i]);
+			}
+			--size_;
+			items_[size_] = T();
+			return begin() + idx;
+		}
+
+		void clear() {
+			for (size_t i = 0; i < size_; ++i) items_[i] = T();
+			size_ = 0;
+		}
+
+		bool operator==(FixedCapacityVector const& rhs) const {
+			if (size_ != rhs.size_) return false;
+			for (size_t i = 0; i < size_; ++i) {
+				if (!(items_[i] == rhs.items_[i])) return false;
+			}
+			return true;
+		}
+		bool operator!=(FixedCapacityVector const& rhs) const { return !(*this == rhs); }
+
+	private:
+		void CheckCapacity() const {
+			if (size_ >= Capacity) throw std::length_error("FixedCapacityVector is full");
+		}
+
+	private:
+		std::array<T, Capacity> items_;
+		size_t size_;
+	};
+}
@@ -5,6 +5,8 @@
 #include <utility>
 #include <type_traits>
 
+#include "Utils/CodeRegistry.h"
+
 namespace Utils
 {
 	template <typename FuncPtr, size_t Size>
@@ -13,9 +15,11 @@ namespace Utils
 	public:
 		FuncPtrArray() : size_(0) {}
 
-		void operator+=(FuncPtr item) {
+		// A captureless lambda, registered in Utils::CodeRegistry
+		template <typename Functor>
+		void operator+=(Functor const& item) {
 			assert(size_ < Size);
-			items_[size_] = item;
+			items_[size_] = CodeRegistry::Bind<FuncPtr>(item);
 			++size_;
 		}
 
@@ -26,6 +30,18 @@ namespace Utils
 			}
 		}
 
+		template <typename Writer>
+		void Save(Writer & writer) const {
+			writer.WriteSize(size_);
+			for (size_t i = 0; i < size_; ++i) writer.WriteCodePointer(items_[i]);
+		}
+
+		template <typename Reader>
+		void Load(Reader & reader) {
+			size_ = reader.ReadSize(Size);
+			for (size_t i = 0; i < size_; ++i) reader.ReadCodePointer(items_[i]);
+		}
+
 	private:
 		std::array<FuncPtr, Size> items_;
 		size_t size_;
@@ -37,9 +53,10 @@ namespace Utils
 	public:
 		FuncPtrArray() : item_(nullptr) {}
 
-		void operator+=(FuncPtr item) {
+		template <typename Functor>
+		void operator+=(Functor const& item) {
 			assert(item_ == nullptr);
-			item_ = item;
+			item_ = CodeRegistry::Bind<FuncPtr>(item);
 		}
 
 		template <typename... Args>
@@ -48,6 +65,16 @@ namespace Utils
 			(*item_)(std::forward<Args>(args)...);
 		}
 
+		template <typename Writer>
+		void Save(Writer & writer) const {
+			writer.WriteCodePointer(item_);
+		}
+
+		template <typename Reader>
+		void Load(Reader & reader) {
+			reader.ReadCodePointer(item_);
+		}
+
 	private:
 		FuncPtr item_;
 	};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 namespace Utils
@@ -62,12 +63,35 @@ namespace Utils
 		NeverShrinkVector() : size_(), container_() {}
 		NeverShrinkVector(size_t size) : size_(size), container_(size) {}
 
+		NeverShrinkVector(NeverShrinkVector const& rhs) :
+			size_(rhs.size_), container_(rhs.container_.begin(), rhs.container_.begin() + rhs.size_)
+		{}
+
+		// The items beyond the copied size are kept, so their buffers are reused by the later pushes
+		NeverShrinkVector & operator=(NeverShrinkVector const& rhs) {
+			if (this == &rhs) return *this;
+			size_t reuse = std::min(rhs.size_, container_.size());
+			std::copy(rhs.container_.begin(), rhs.container_.begin() + reuse, container_.begin());
+			container_.insert(container_.end(), rhs.container_.begin() + reuse, rhs.container_.begin() + rhs.size_);
+			size_ = rhs.size_;
+			return *this;
+		}
+
+		NeverShrinkVector(NeverShrinkVector &&) = default;
+		NeverShrinkVector & operator=(NeverShrinkVector &&) = default;
+
 		auto begin() {
 			return container_.begin();
 		}
 		auto end() {
 			return container_.begin() + size_;
 		}
+		auto begin() const {
+			return container_.begin();
+		}
+		auto end() const {
+			return container_.begin() + size_;
+		}
 
 		auto const& operator[](size_t idx) const {
 			assert(idx < size_);
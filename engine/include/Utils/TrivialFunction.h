@@ -0,0 +1,76 @@
+#pragma once
+
+#include <assert.h>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Utils/CodeRegistry.h"
+
+namespace Utils
+{
+	template <typename Signature, size_t BufferSize = 3 * sizeof(void*)>
+	class TrivialFunction;
+
+	// A replacement of std::function for small, trivially-copyable callables
+	// The callable is stored in an inline buffer, so it never allocates,
+	// and the wrapper itself is trivially copyable (i.e., can be copied by memcpy).
+	// A lambda capturing a few values (e.g., a CardRef and a turn number) fits in the buffer.
+	// The captures should be plain values rather than pointers, since the buffer is also archived
+	//    bytewise (see Utils::BinaryWriter). The invoker is archived by its id in Utils::CodeRegistry.
+	template <typename RetType, typename... Args, size_t BufferSize>
+	class TrivialFunction<RetType(Args...), BufferSize>
+	{
+	public:
+		TrivialFunction() : invoker_(nullptr), buffer_() {}
+
+		template <typename Functor, typename = std::enable_if_t<
+			!std::is_same_v<std::decay_t<Functor>, TrivialFunction> &&
+			std::is_invocable_r_v<RetType, std::decay_t<Functor>&, Args...>>>
+		TrivialFunction(Functor&& functor) : invoker_(&Invoke<std::decay_t<Functor>>), buffer_()
+		{
+			using FunctorType = std::decay_t<Functor>;
+			static_assert(std::is_trivially_copyable_v<FunctorType>, "Captures should be trivially copyable");
+			static_assert(std::is_trivially_destructible_v<FunctorType>, "Captures should be trivially destructible");
+			static_assert(sizeof(FunctorType) <= BufferSize, "Captures are too large");
+			static_assert(alignof(FunctorType) <= alignof(void*), "Captures are over-aligned");
+
+			CodeRegistry::Register<Invoker<FunctorType>>();
+			new (buffer_) FunctorType(std::forward<Functor>(functor));
+		}
+
+		explicit operator bool() const { return invoker_ != nullptr; }
+
+		RetType operator()(Args... args) const {
+			assert(invoker_);
+			return (*invoker_)(buffer_, std::forward<Args>(args)...);
+		}
+
+		template <typename Writer>
+		void Save(Writer & writer) const {
+			writer.WriteCodePointer(invoker_);
+			writer.WriteRaw(buffer_);
+		}
+
+		template <typename Reader>
+		void Load(Reader & reader) {
+			reader.ReadCodePointer(invoker_);
+			reader.ReadRaw(buffer_);
+		}
+
+	private:
+		template <typename FunctorType>
+		struct Invoker {
+			static auto Get() { return &Invoke<FunctorType>; }
+		};
+
+		template <typename FunctorType>
+		static RetType Invoke(void * buffer, Args... args) {
+			return (*reinterpret_cast<FunctorType*>(buffer))(std::forward<Args>(args)...);
+		}
+
+	private:
+		RetType(*invoker_)(void *, Args...);
+		alignas(void*) mutable unsigned char buffer_[BufferSize]; // a mutable lambda may change its captures
+	};
+}
@@ -23,19 +23,19 @@ namespace engine
 			std::vector<int> targets;
 		};
 		struct ChooseDefenderInfo {
-			ChooseDefenderInfo(std::vector<state::CardRef> targets) : targets(targets) {}
-			std::vector<state::CardRef> targets;
+			ChooseDefenderInfo(FlowControl::CardRefChoices const& targets) : targets(targets) {}
+			FlowControl::CardRefChoices targets;
 		};
 		struct GetSpecifiedTargetInfo {
-			GetSpecifiedTargetInfo(state::CardRef card_ref, std::vector<state::CardRef> targets) :
+			GetSpecifiedTargetInfo(state::CardRef card_ref, FlowControl::CardRefChoices const& targets) :
 				card_ref(card_ref), targets(targets)
 			{}
 			state::CardRef card_ref;
-			std::vector<state::CardRef> targets;
+			FlowControl::CardRefChoices targets;
 		};
 		struct ChooseOneInfo {
-			ChooseOneInfo(std::vector<Cards::CardId> const& cards) : cards(cards) {}
-			std::vector<Cards::CardId> cards;
+			ChooseOneInfo(FlowControl::CardIdChoices const& cards) : cards(cards) {}
+			FlowControl::CardIdChoices cards;
 		};
 		struct ChooseRandomInfo {
 			ChooseRandomInfo(int exclusive_max) : exclusive_max(exclusive_max) {}
@@ -1,12 +1,13 @@
 #pragma once
 
 #include <assert.h>
-#include <vector>
-#include <functional>
 #include "Cards/id-map.h"
+#include "engine/FlowControl/IActionParameterGetter.h"
 
 namespace engine
 {
+	// The choices of a decision; a plain value without allocation, so it can be passed around freely
+	// The choices are read by index (Get(idx)) or by ForEach(), without any iteration state
 	class ActionChoices
 	{
 	public:
@@ -19,14 +20,12 @@ namespace engine
 	public:
 		explicit ActionChoices(int exclusive_max) :
 			type_(kChooseFromZeroToExclusiveMax),
-			exclusive_max_(exclusive_max), card_ids_(),
-			range_it_(0), card_ids_it_()
+			exclusive_max_(exclusive_max), card_ids_()
 		{}
 
-		explicit ActionChoices(std::vector<Cards::CardId> const& cards) :
+		explicit ActionChoices(FlowControl::CardIdChoices const& cards) :
 			type_(kChooseFromCardIds),
-			exclusive_max_(0), card_ids_(cards),
-			range_it_(0), card_ids_it_()
+			exclusive_max_(0), card_ids_(cards)
 		{}
 
 		Type GetType() const { return type_; }
@@ -77,44 +76,30 @@ namespace engine
 			}
 		}
 
-		void Begin() {
+		// Functor: bool(int choice), return true to continue; false to abort
+		template <typename Functor>
+		void ForEach(Functor&& functor) const {
 			if (type_ == kChooseFromCardIds) {
-				card_ids_it_ = card_ids_.begin();
+				for (Cards::CardId card_id : card_ids_) {
+					if (!functor((int)card_id)) return;
+				}
 			}
 			else {
 				assert(type_ == kChooseFromZeroToExclusiveMax);
-				range_it_ = 0;
+				for (int i = 0; i < exclusive_max_; ++i) {
+					if (!functor(i)) return;
+				}
 			}
 		}
 
-		int Get() const {
-			if (type_ == kChooseFromCardIds) {
-				return (int)*card_ids_it_;
-			}
-			else {
-				assert(type_ == kChooseFromZeroToExclusiveMax);
-				return range_it_;
-			}
-		}
-
-		void StepNext() {
-			if (type_ == kChooseFromCardIds) {
-				++card_ids_it_;
-			}
-			else {
-				assert(type_ == kChooseFromZeroToExclusiveMax);
-				++range_it_;
-			}
-		}
-
-		bool IsEnd() const {
-			if (type_ == kChooseFromCardIds) {
-				return card_ids_it_ == card_ids_.end();
-			}
-			else {
-				assert(type_ == kChooseFromZeroToExclusiveMax);
-				return range_it_ >= exclusive_max_;
-			}
+		bool Contains(int choice) const {
+			bool found = false;
+			ForEach([&](int item) {
+				if (item != choice) return true;
+				found = true;
+				return false;
+			});
+			return found;
 		}
 
 	private:
@@ -122,10 +107,6 @@ namespace engine
 
 		int exclusive_max_;
 
-		std::vector<Cards::CardId> card_ids_;
-
-	private: // iterate progress
-		int range_it_;
-		std::vector<Cards::CardId>::iterator card_ids_it_;
+		FlowControl::CardIdChoices card_ids_;
 	};
 }
\ No newline at end of file
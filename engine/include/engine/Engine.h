@@ -0,0 +1,12 @@
+#pragma once
+
+// Public header of the compiled engine library (see engine/Library.h)
+// Nothing here instantiates the cards; link with libhsengine.a instead of including the -impl headers.
+
+#include "engine/Library.h"
+#include "engine/Game.h"
+#include "engine/ValidActionAnalyzer.h"
+#include "state/Cards/Card.h"
+#include "Cards/CardDispatcher.h"
+#include "Cards/Database.h"
+#include "Cards/PreIndexedCards.h"
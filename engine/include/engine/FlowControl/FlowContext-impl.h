@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include "engine/FlowControl/detail/Resolver-impl.h"
 #include "engine/FlowControl/FlowContext.h"
 #include "engine/FlowControl/Manipulate.h"
@@ -10,19 +12,22 @@ namespace engine {
 			state::State & state, state::CardRef card_ref, state::targetor::Targets const & target_info)
 		{
 			assert(!specified_target_.IsValid());
-			targets_.clear();
-			target_info.Fill(state, targets_);
+			state::targetor::TargetSet targets = target_info.GetTargetSet(state);
+			int count = targets.Count();
 
-			if (targets_.empty()) {
+			if (count == 0) {
 				specified_target_.Invalidate();
 				return;
 			}
 
-			if (targets_.size() <= 1) {
-				specified_target_ = targets_[0];
+			if (count == 1) {
+				specified_target_ = targets.Get(state, 0);
 				return;
 			}
 
+			// The card refs are listed only when the agent needs to choose
+			targets_.clear();
+			targets.Fill(state, targets_);
 			specified_target_ = action_parameters_->GetSpecifiedTarget(state, card_ref, targets_);
 			assert(specified_target_.IsValid());
 		}
@@ -31,7 +36,9 @@ namespace engine {
 		{
 			int play_order = state.GetCardsManager().Get(ref).GetPlayOrder();
 
-			dead_entity_hints_.insert(std::make_pair(play_order, ref));
+			auto it = std::upper_bound(dead_entity_hints_.begin(), dead_entity_hints_.end(), play_order,
+				[](int lhs, auto const& rhs) { return lhs < rhs.first; });
+			dead_entity_hints_.insert(it, std::make_pair(play_order, ref));
 		}
 
 		inline bool FlowContext::Empty() const
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <map>
+#include <utility>
+#include <vector>
 
 #include "state/Types.h"
 #include "engine/Result.h"
@@ -62,7 +63,7 @@ namespace engine {
 
 			auto GetAttacker() { return action_parameters_->GetAttacker(); }
 
-			state::CardRef GetDefender(std::vector<state::CardRef> const& defenders) {
+			state::CardRef GetDefender(CardRefChoices const& defenders) {
 				assert(!defenders.empty());
 				if (defenders.size() <= 1) return defenders[0];
 				return action_parameters_->GetDefender(defenders);
@@ -86,7 +87,7 @@ namespace engine {
 			void ChangeSpecifiedTarget(state::CardRef target) { specified_target_ = target; }
 			state::CardRef GetSpecifiedTarget() const { return specified_target_; }
 
-			Cards::CardId UserChooseOne(std::vector<Cards::CardId> const& cards) {
+			Cards::CardId UserChooseOne(CardIdChoices const& cards) {
 				if (cards.size() <= 1) return cards[0];
 				return action_parameters_->ChooseOne(cards);
 			}
@@ -132,12 +133,12 @@ namespace engine {
 			engine::Result result_;
 			IActionParameterGetter * action_parameters_;
 			IRandomGenerator * random_;
-			std::multimap<int, state::CardRef> dead_entity_hints_;
+			std::vector<std::pair<int, state::CardRef>> dead_entity_hints_; // ordered by play order
 			int minion_put_location_;
 			state::CardRef specified_target_;
 			state::CardRef destroyed_weapon_;
 			Cards::CardId user_choice_;
-			std::vector<state::CardRef> targets_;
+			CardRefChoices targets_;
 			detail::Resolver resolver_;
 		};
 	}
@@ -1,34 +1,56 @@
 #pragma once
 
+#include "engine/Library.h"
 #include "engine/FlowControl/FlowController.h"
 #include "engine/FlowControl/ValidActionGetter.h"
+#include "Cards/CardDispatcher.h"
 
 #include "engine/FlowControl/Manipulate-impl.h"
 
 namespace engine {
 	namespace FlowControl
 	{
-		inline engine::Result FlowController::PerformAction()
+		HSENGINE_ENTRY_POINT engine::Result FlowController::PerformAction()
 		{
+			flow_context_.GetResolver().Reset(); // the state might be changed since the last action
+
 			auto main_op = flow_context_.GetMainOp();
 
+			engine::Result result = engine::Result::kResultInvalid;
 			switch (main_op) {
 			case engine::kMainOpPlayCard:
-				return PlayCard(flow_context_.ChooseHandCard());
+				result = PlayCard(flow_context_.ChooseHandCard());
+				break;
 			case engine::kMainOpAttack:
-				return Attack(flow_context_.GetAttacker());
+				result = Attack(flow_context_.GetAttacker());
+				break;
 			case engine::kMainOpHeroPower:
-				return HeroPower();
+				result = HeroPower();
+				break;
 			case engine::kMainOpEndTurn:
-				return EndTurn();
+				result = EndTurn();
+				break;
 			default:
 				return engine::Result::kResultInvalid;
 			}
+
+			// event handlers removed during the action are erased once here
+			state_.CompactEvents();
+			return result;
+		}
+
+		HSENGINE_ENTRY_POINT engine::Result FlowController::PerformAction(state::UndoJournal & journal)
+		{
+			journal.Begin(state_);
+			engine::Result result = PerformAction();
+			journal.End(state_);
+			return result;
 		}
 
 		inline engine::Result FlowController::PlayCard(int hand_idx)
 		{
 			assert(ValidActionGetter(state_).IsPlayable(hand_idx));
+			assert((ValidActionGetter(state_).GetPlayableCardsMask() >> hand_idx) & 1);
 
 			flow_context_.Reset();
 
@@ -71,6 +93,7 @@ namespace engine {
 
 		inline engine::Result FlowController::Resolve()
 		{
+			flow_context_.GetResolver().Reset();
 			flow_context_.GetResolver().Resolve(state_, flow_context_);
 			return flow_context_.GetResult();
 		}
@@ -81,7 +104,12 @@ namespace engine {
 			{
 			case state::kCardTypeMinion:
 				assert(!state_.GetCurrentPlayer().minions_.Full());
-				if (!PlayCardPhase<state::kCardTypeMinion>(card_ref)) return;
+				if (Cards::CardDispatcher::IsVanilla(state_.GetCard(card_ref).GetCardId())) {
+					if (!PlayCardPhase<state::kCardTypeMinion, true>(card_ref)) return;
+				}
+				else {
+					if (!PlayCardPhase<state::kCardTypeMinion>(card_ref)) return;
+				}
 				break;
 			case state::kCardTypeWeapon:
 				if (!PlayCardPhase<state::kCardTypeWeapon>(card_ref)) return;
@@ -89,6 +117,7 @@ namespace engine {
 			case state::kCardTypeSpell:
 				assert([&]() {
 					if (!state_.GetCard(card_ref).IsSecretCard()) return true;
+					if (state_.GetCurrentPlayer().secrets_.Full()) return false;
 					if (state_.GetCurrentPlayer().secrets_.Exists(state_.GetCard(card_ref).GetCardId())) return false;
 					return true;
 				}());
@@ -104,7 +133,7 @@ namespace engine {
 			++state_.GetCurrentPlayer().played_cards_this_turn_;
 		}
 
-		template <state::CardType CardType>
+		template <state::CardType CardType, bool Vanilla>
 		inline bool FlowController::PlayCardPhase(state::CardRef card_ref)
 		{
 			int cost = state_.GetCard(card_ref).GetCost();
@@ -119,15 +148,23 @@ namespace engine {
 			state_.IncreasePlayOrder();
 			Manipulate(state_, flow_context_).Card(card_ref).SetPlayOrder();
 
-			state_.GetCard(card_ref).GetRawData().onplay_handler.PrepareTarget(state_, flow_context_, state_.GetCurrentPlayerId(), card_ref);
-
-			state::CardRef onplay_target = flow_context_.GetSpecifiedTarget();
-			if (onplay_target.IsValid()) {
-				state_.TriggerEvent<state::Events::EventTypes::PreparePlayCardTarget>(state::Events::EventTypes::PreparePlayCardTarget::Context{
-					Manipulate(state_, flow_context_), card_ref, &onplay_target
-				});
-				assert(onplay_target.IsValid());
-				flow_context_.ChangeSpecifiedTarget(onplay_target);
+			if constexpr (Vanilla) {
+				// no choice and no target to prepare
+				assert(state_.GetCard(card_ref).GetOnPlayHandler().Empty());
+				assert(flow_context_.GetSavedUserChoice() == Cards::kInvalidCardId);
+				assert(!flow_context_.GetSpecifiedTarget().IsValid());
+			}
+			else {
+				state_.GetCard(card_ref).GetOnPlayHandler().PrepareTarget(state_, flow_context_, state_.GetCurrentPlayerId(), card_ref);
+
+				state::CardRef onplay_target = flow_context_.GetSpecifiedTarget();
+				if (onplay_target.IsValid()) {
+					state_.TriggerEvent<state::Events::EventTypes::PreparePlayCardTarget>(state::Events::EventTypes::PreparePlayCardTarget::Context{
+						Manipulate(state_, flow_context_), card_ref, &onplay_target
+					});
+					assert(onplay_target.IsValid());
+					flow_context_.ChangeSpecifiedTarget(onplay_target);
+				}
 			}
 
 			state_.TriggerEvent<state::Events::EventTypes::OnPlay>(
@@ -144,7 +181,7 @@ namespace engine {
 
 			state_.GetCurrentPlayer().GetResource().IncreaseNextOverload(state_.GetCard(card_ref).GetRawData().overload);
 
-			return PlayCardPhaseInternal<CardType>(card_ref);
+			return PlayCardPhaseInternal<CardType, Vanilla>(card_ref);
 		}
 
 		inline void FlowController::CostCrystal(int amount) {
@@ -170,7 +207,13 @@ namespace engine {
 		template <> inline bool FlowController::PlayCardPhaseInternal<state::kCardTypeMinion>(state::CardRef card_ref)
 		{
 			assert(state_.GetCard(card_ref).GetCardType() == state::kCardTypeMinion);
-			return PlayMinionCardPhase(card_ref);
+			return PlayMinionCardPhase<false>(card_ref);
+		}
+
+		template <> inline bool FlowController::PlayCardPhaseInternal<state::kCardTypeMinion, true>(state::CardRef card_ref)
+		{
+			assert(state_.GetCard(card_ref).GetCardType() == state::kCardTypeMinion);
+			return PlayMinionCardPhase<true>(card_ref);
 		}
 
 		template <> inline bool FlowController::PlayCardPhaseInternal<state::kCardTypeWeapon>(state::CardRef card_ref)
@@ -191,6 +234,7 @@ namespace engine {
 			return PlayHeroPowerCardPhase(card_ref);
 		}
 
+		template <bool Vanilla>
 		inline bool FlowController::PlayMinionCardPhase(state::CardRef card_ref)
 		{
 			state_.TriggerEvent<state::Events::EventTypes::BeforeMinionSummoned>(
@@ -212,7 +256,9 @@ namespace engine {
 
 			assert(state_.GetCard(card_ref).GetPlayerIdentifier() == state_.GetCurrentPlayerId());
 			state::CardRef new_card_ref;
-			state_.GetCard(card_ref).GetRawData().onplay_handler.OnPlay(state_, flow_context_, state_.GetCurrentPlayerId(), card_ref, &new_card_ref);
+			if constexpr (!Vanilla) {
+				state_.GetCard(card_ref).GetOnPlayHandler().OnPlay(state_, flow_context_, state_.GetCurrentPlayerId(), card_ref, &new_card_ref);
+			}
 			if (!new_card_ref.IsValid()) {
 				// no transformation
 				new_card_ref = card_ref;
@@ -249,7 +295,7 @@ namespace engine {
 			state::CardRef new_card_ref;
 
 			assert(state_.GetCard(card_ref).GetPlayerIdentifier() == state_.GetCurrentPlayerId());
-			state_.GetCard(card_ref).GetRawData().onplay_handler.OnPlay(state_, flow_context_, state_.GetCurrentPlayerId(), card_ref, &new_card_ref);
+			state_.GetCard(card_ref).GetOnPlayHandler().OnPlay(state_, flow_context_, state_.GetCurrentPlayerId(), card_ref, &new_card_ref);
 			assert(!new_card_ref.IsValid()); // weapon cannot transformed
 
 			return true;
@@ -259,7 +305,7 @@ namespace engine {
 		{
 			state::CardRef new_card_ref;
 
-			state_.GetCard(card_ref).GetRawData().onplay_handler.OnPlay(state_, flow_context_, state_.GetCurrentPlayerId(), card_ref, &new_card_ref);
+			state_.GetCard(card_ref).GetOnPlayHandler().OnPlay(state_, flow_context_, state_.GetCurrentPlayerId(), card_ref, &new_card_ref);
 			assert(!new_card_ref.IsValid()); // hero power cannot transformed
 
 			state_.TriggerEvent<state::Events::EventTypes::AfterHeroPower>(
@@ -274,16 +320,17 @@ namespace engine {
 			bool is_secret = state_.GetCard(card_ref).IsSecretCard();
 
 			if (is_secret) {
-				if (state_.GetCurrentPlayer().secrets_.Exists(state_.GetCard(card_ref).GetCardId())) {
+				auto const& secrets = state_.GetCurrentPlayer().secrets_;
+				if (secrets.Full() || secrets.Exists(state_.GetCard(card_ref).GetCardId())) {
 					// before playing this secret card, we've ensured (by an assert) that there's no such secret
-					// but now, there's a same secret now
+					// but now, there's a same secret (or the secret zone is full) now
 					// this might due to some pre-triggers
 					// However, this should be considered as a valid game action.
 					return true;
 				}
 			}
 
-			state_.GetCard(card_ref).GetRawData().onplay_handler.OnPlay(state_, flow_context_, state_.GetCurrentPlayerId(), card_ref, &new_card_ref);
+			state_.GetCard(card_ref).GetOnPlayHandler().OnPlay(state_, flow_context_, state_.GetCurrentPlayerId(), card_ref, &new_card_ref);
 			assert(!new_card_ref.IsValid()); // spell cannot be transformed
 
 			if (is_secret) {
@@ -364,7 +411,7 @@ namespace engine {
 
 		inline state::CardRef FlowController::GetDefender(state::CardRef attacker)
 		{
-			std::vector<state::CardRef> defenders;
+			CardRefChoices defenders;
 
 			auto HasTaunt = [&](state::CardRef card_ref) {
 				state::Cards::Card const& card = state_.GetCard(card_ref);
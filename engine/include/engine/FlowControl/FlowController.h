@@ -1,6 +1,7 @@
 #pragma once
 
 #include "state/State.h"
+#include "state/UndoJournal.h"
 #include "state/targetor/Targets-impl.h"
 #include "state/detail/InvokeCallback-impl.h"
 
@@ -38,6 +39,9 @@ namespace engine {
 		public: // main flow
 			engine::Result PerformAction();
 
+			// Perform an action in a new frame of the journal, so it can be undone later
+			engine::Result PerformAction(state::UndoJournal & journal);
+
 		private:
 			engine::Result PlayCard(int hand_idx);
 			engine::Result Attack(state::CardRef attacker);
@@ -54,10 +58,11 @@ namespace engine {
 			void CostCrystal(int amount);
 			void CostHealth(int amount);
 
-			template <state::CardType> bool PlayCardPhase(state::CardRef card_ref);
-			template <state::CardType> bool PlayCardPhaseInternal(state::CardRef card_ref);
+			// Vanilla: the card has no on-play handler (see Cards::CardTraits)
+			template <state::CardType, bool Vanilla = false> bool PlayCardPhase(state::CardRef card_ref);
+			template <state::CardType, bool Vanilla = false> bool PlayCardPhaseInternal(state::CardRef card_ref);
 
-			bool PlayMinionCardPhase(state::CardRef card_ref);
+			template <bool Vanilla> bool PlayMinionCardPhase(state::CardRef card_ref);
 			bool PlayWeaponCardPhase(state::CardRef card_ref);
 			bool PlayHeroPowerCardPhase(state::CardRef card_ref);
 			bool PlaySpellCardPhase(state::CardRef card_ref);
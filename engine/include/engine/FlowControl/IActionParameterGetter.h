@@ -1,13 +1,11 @@
 #pragma once
 
-#include <vector>
-
+#include "Utils/FixedCapacityVector.h"
 #include "state/Types.h"
 #include "state/targetor/Targets.h"
 #include "Cards/id-map.h"
 #include "engine/MainOp.h"
 #include "engine/ActionType.h"
-#include "engine/ActionChoices.h"
 
 namespace state {
 	class State;
@@ -15,6 +13,13 @@ namespace state {
 
 namespace engine {
 	namespace FlowControl {
+		constexpr size_t kMaxChoices = 16; // max #-of-choices: choose target
+		constexpr size_t kMaxChooseOneChoices = 4; // max #-of-choices: choose one (discover offers three)
+
+		// The choices are passed in inline containers, so making a decision needs no allocation
+		using CardRefChoices = Utils::FixedCapacityVector<state::CardRef, kMaxChoices>;
+		using CardIdChoices = Utils::FixedCapacityVector<Cards::CardId, kMaxChooseOneChoices>;
+
 		class IActionParameterGetter
 		{
 		public:
@@ -23,7 +28,7 @@ namespace engine {
 			IActionParameterGetter(IActionParameterGetter const&) = delete;
 			IActionParameterGetter & operator=(IActionParameterGetter const&) = delete;
 
-			static constexpr size_t kMaxChoices = 16; // max #-of-choices: choose target
+			static constexpr size_t kMaxChoices = FlowControl::kMaxChoices;
 
 			virtual MainOpType ChooseMainOp() = 0;
 
@@ -31,16 +36,16 @@ namespace engine {
 			virtual int ChooseHandCard() = 0;
 
 			virtual state::CardRef GetAttacker() = 0;
-			virtual state::CardRef GetDefender(std::vector<state::CardRef> const& targets) = 0;
+			virtual state::CardRef GetDefender(CardRefChoices const& targets) = 0;
 
 			virtual int GetMinionPutLocation(int minions) = 0;
 
 			// spell target
 			virtual state::CardRef GetSpecifiedTarget(
 				state::State & state, state::CardRef card_ref,
-				std::vector<state::CardRef> const& targets) = 0;
+				CardRefChoices const& targets) = 0;
 
-			virtual Cards::CardId ChooseOne(std::vector<Cards::CardId> const& cards) = 0;
+			virtual Cards::CardId ChooseOne(CardIdChoices const& cards) = 0;
 		};
 	}
 }
\ No newline at end of file
@@ -82,14 +82,13 @@ namespace engine {
 
 		inline state::CardRef Manipulate::GetRandomTarget(state::targetor::Targets const & target_info) const
 		{
-			std::vector<state::CardRef> targets;
-			target_info.Fill(state_, targets);
+			state::targetor::TargetSet targets = target_info.GetTargetSet(state_);
 
-			size_t count = targets.size();
+			int count = targets.Count();
 			if (count == 0) return state::CardRef();
-			if (count == 1) return targets.front();
+			if (count == 1) return targets.Get(state_, 0);
 
-			return targets[flow_context_.GetRandom().Get(count)];
+			return targets.Get(state_, flow_context_.GetRandom().Get(count));
 		}
 
 		inline state::Cards::Card const& Manipulate::GetCard(state::CardRef ref) const
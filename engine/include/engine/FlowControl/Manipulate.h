@@ -73,7 +73,7 @@ namespace engine {
 
 		public: // bridge to flow context
 			state::CardRef GetSpecifiedTarget() const { return flow_context_.GetSpecifiedTarget(); }
-			Cards::CardId UserChooseOne(std::vector<Cards::CardId> const& cards) const { return flow_context_.UserChooseOne(cards); }
+			Cards::CardId UserChooseOne(CardIdChoices const& cards) const { return flow_context_.UserChooseOne(cards); }
 			IRandomGenerator & GetRandom() const { return flow_context_.GetRandom(); }
 
 			void SaveUserChoice(Cards::CardId choice) const { flow_context_.SaveUserChoice(choice); }
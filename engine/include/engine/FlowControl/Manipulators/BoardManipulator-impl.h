@@ -19,16 +19,14 @@ namespace engine {
 
 			inline state::CardRef BoardManipulator::AddCardById(Cards::CardId card_id, state::PlayerIdentifier player)
 			{
-				state::Cards::CardData new_data = Cards::CardDispatcher::CreateInstance(card_id);
-				new_data.enchanted_states.player = player;
-				new_data.enchantment_handler.SetOriginalStates(new_data.enchanted_states);
-
-				return state_.AddCard(GenerateCard(std::move(new_data), player));
+				state::Cards::Card card;
+				card.RefCopy(Cards::CardDispatcher::GetPrototype(card_id, player));
+				return state_.AddCard(GenerateCard(std::move(card)));
 			}
 
 			inline state::CardRef BoardManipulator::AddCardByCopy(state::Cards::Card const & card, state::PlayerIdentifier player)
 			{
-				state::Cards::CardData new_data = card.GetRawData();
+				state::Cards::CardData new_data = card.GetRawDataCopy();
 
 				if (new_data.enchanted_states.player != player) {
 					auto origin_states = new_data.enchantment_handler.GetOriginalStates();
@@ -37,7 +35,7 @@ namespace engine {
 					new_data.enchanted_states.player = player;
 				}
 
-				state::CardRef card_ref = state_.AddCard(GenerateCard(std::move(new_data), player));
+				state::CardRef card_ref = state_.AddCard(GenerateCard(state::Cards::Card(std::move(new_data))));
 
 				state_.GetMutableCard(card_ref).GetMutableEnchantmentHandler()
 					.AfterCopied(FlowControl::Manipulate(state_, flow_context_), card_ref);
@@ -45,11 +43,11 @@ namespace engine {
 				return card_ref;
 			}
 
-			inline state::Cards::Card BoardManipulator::GenerateCard(state::Cards::CardData card_data, state::PlayerIdentifier player)
+			inline state::Cards::Card BoardManipulator::GenerateCard(state::Cards::Card card)
 			{
-				assert(((card_data.zone = state::kCardZoneNewlyCreated), true)); // assign it just for debug assertion
-				card_data.play_order = state_.GetPlayOrder();
-				return state::Cards::Card(std::move(card_data));
+				assert((card.SetZone().Zone(state::kCardZoneNewlyCreated), true)); // assign it just for debug assertion
+				card.SetPlayOrder(state_.GetPlayOrder());
+				return card;
 			}
 
 			inline state::CardRef BoardManipulator::SummonMinion(state::CardRef card_ref, int pos)
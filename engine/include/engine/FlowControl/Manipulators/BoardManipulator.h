@@ -50,7 +50,7 @@ namespace engine {
 				void CalculateFinalDamageAmount(state::CardRef source, int amount, int * final_amount);
 
 			private:
-				state::Cards::Card GenerateCard(state::Cards::CardData card_data, state::PlayerIdentifier player);
+				state::Cards::Card GenerateCard(state::Cards::Card card);
 
 				state::CardRef SummonMinion(state::CardRef card_ref, int pos);
 
@@ -22,7 +22,7 @@ namespace engine {
 				// Remove all deathrattles
 				GetCard().GetMutableDeathrattleHandler().Clear();
 
-				static_assert(state::Cards::CardData::kFieldChangeId == 2);
+				static_assert(state::Cards::CardStates::kFieldChangeId == 2);
 				GetCard().SetTaunt(false);
 				GetCard().SetShield(false);
 				GetCard().SetCantAttack(false);
@@ -38,8 +38,12 @@ namespace engine {
 				assert(GetCard().GetPlayerIdentifier().Opposite() == new_owner);
 
 				int new_pos = (int)state_.GetBoard().Get(new_owner).minions_.Size();
-				return MinionManipulator<state::kCardZonePlay>(state_, flow_context_, card_ref_)
+				MinionManipulator<state::kCardZonePlay>(state_, flow_context_, card_ref_)
 					.MoveTo<state::kCardZonePlay>(new_owner, new_pos);
+				if (state_.GetCard(card_ref_).GetPlayerIdentifier() != new_owner) return; // destroyed since the board is full
+
+				// the original states also change, or the next enchantment update would move it back
+				state_.GetMutableCard(card_ref_).GetMutableEnchantmentHandler().GetMutableOriginalStates().player = new_owner;
 			}
 
 			inline state::CardRef OnBoardMinionManipulator::Transform(Cards::CardId id)
@@ -84,7 +88,8 @@ namespace engine {
 				return new_card_ref;
 			}
 
-			inline void OnBoardMinionManipulator::AddDeathrattle(FlowControl::deathrattle::Handler::DeathrattleCallback * deathrattle)
+			template <typename Functor>
+			inline void OnBoardMinionManipulator::AddDeathrattle(Functor const& deathrattle)
 			{
 				if (GetCard().GetZone() != state::kCardZonePlay) return;
 				state_.GetMutableCard(card_ref_).GetMutableDeathrattleHandler().Add(deathrattle);
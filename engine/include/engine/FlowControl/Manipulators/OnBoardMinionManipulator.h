@@ -52,7 +52,7 @@ namespace engine {
 					return true;
 				}
 
-				void AddDeathrattle(FlowControl::deathrattle::Handler::DeathrattleCallback* deathrattle);
+				template <typename Functor> void AddDeathrattle(Functor const& deathrattle);
 
 			public: // bridge to MinionManipulator<state::kCardZonePlay>
 				template<state::CardZone SwapWithZone> void SwapWith(state::CardRef ref) {
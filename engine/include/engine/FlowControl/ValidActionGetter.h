@@ -1,7 +1,8 @@
 #pragma once
 
-#include <vector>
+#include "Utils/Bits.h"
 #include "state/State.h"
+#include "engine/FlowControl/IActionParameterGetter.h"
 
 namespace engine {
 	namespace FlowControl
@@ -18,13 +19,28 @@ namespace engine {
 			template <class Functor>
 			void ForEachPlayableCard(Functor && op) const
 			{
-				auto const& hand = state_.GetCurrentPlayer().hand_;
-				for (size_t idx = 0; idx < hand.Size(); ++idx) {
-					if (!IsPlayable(idx)) continue;
-					if (!op(idx)) return;
+				for (uint32_t mask = GetPlayableCardsMask(); mask; mask &= mask - 1) {
+					if (!op((size_t)Utils::CountTrailingZeros(mask))) return;
 				}
 			}
 
+			// Bit i is set if the i-th hand card is playable
+			// The result is cached in the state; the consecutive queries on an unchanged state
+			//    (e.g., from the agent and from its policies) do not run the playable checks again
+			uint32_t GetPlayableCardsMask() const
+			{
+				state::State::PlayableCardsKey key = state_.GetPlayableCardsKey();
+				uint32_t mask = 0;
+				if (state_.GetCachedPlayableCards(key, &mask)) {
+					assert(mask == ComputePlayableCardsMask());
+					return mask;
+				}
+
+				mask = ComputePlayableCardsMask();
+				state_.SetCachedPlayableCards(key, mask);
+				return mask;
+			}
+
 			bool IsPlayable(size_t hand_idx) const
 			{
 				auto const& hand = state_.GetCurrentPlayer().hand_;
@@ -36,10 +52,12 @@ namespace engine {
 				}
 
 				if (card.IsSecretCard()) {
-					if (state_.GetCurrentPlayer().secrets_.Exists(card.GetCardId())) return false;
+					auto const& secrets = state_.GetCurrentPlayer().secrets_;
+					if (secrets.Full()) return false;
+					if (secrets.Exists(card.GetCardId())) return false;
 				}
 
-				if (!card.GetRawData().onplay_handler.CheckPlayable(state_, state_.GetCurrentPlayerId(), card_ref)) {
+				if (!card.GetOnPlayHandler().CheckPlayable(state_, state_.GetCurrentPlayerId(), card_ref)) {
 					return false;
 				}
 
@@ -69,15 +87,7 @@ namespace engine {
 				assert(card.GetHP() > 0);
 				assert(card.GetZone() == state::kCardZonePlay);
 
-				if (card.GetRawData().cant_attack) return false;
-				if (card.GetRawData().freezed) return false;
-
-				if (card.GetCardType() == state::kCardTypeMinion) {
-					if (card.HasCharge() == false && card.GetRawData().just_played) return false;
-				}
-
-				if (card.GetRawData().num_attacks_this_turn >= card.GetMaxAttacksPerTurn()) return false;
-
+				if (!card.IsReadyToAttack()) return false;
 				if (state_.GetCardAttackConsiderWeapon(card) <= 0) return false;
 
 				return true;
@@ -90,21 +100,19 @@ namespace engine {
 			//   7: hero
 			template <typename Functor>
 			void ForEachAttacker(Functor&& functor) const {
-				auto const& player = state_.GetBoard().Get(state_.GetCurrentPlayerId());
-				auto op = [&](state::CardRef card_ref) { return IsAttackable(card_ref); };
+				auto const& stats = state_.GetCharacterStats(state_.GetCurrentPlayerId());
 
-				int minion_idx = 0;
-				if (!player.minions_.ForEach([&](state::CardRef card_ref) {
-					if (op(card_ref)) {
-						if (!functor(minion_idx)) return false;
+				for (int minion_idx = 0; minion_idx < stats.minions_count; ++minion_idx) {
+					assert(stats.IsAttackable(minion_idx) == IsAttackable(stats.refs[minion_idx]));
+					if (stats.IsAttackable(minion_idx)) {
+						if (!functor(minion_idx)) return;
 					}
-					++minion_idx;
-					return true;
-				})) return;
+				}
 
-				state::CardRef hero_ref = player.GetHeroRef();
-				if (op(hero_ref)) {
-					if (!functor(7)) return;
+				constexpr int hero_idx = state::board::CharacterStats::kHeroIndex;
+				assert(stats.IsAttackable(hero_idx) == IsAttackable(stats.refs[hero_idx]));
+				if (stats.IsAttackable(hero_idx)) {
+					if (!functor(hero_idx)) return;
 				}
 			}
 
@@ -129,8 +137,8 @@ namespace engine {
 				return ret;
 			}
 
-			std::vector<state::CardRef> GetDefenders() const {
-				std::vector<state::CardRef> defenders;
+			CardRefChoices GetDefenders() const {
+				CardRefChoices defenders;
 				auto const& player = state_.GetBoard().Get(state_.GetCurrentPlayerId().Opposite());
 
 				state::CardRef hero_ref = player.GetHeroRef();
@@ -157,6 +165,17 @@ namespace engine {
 			}
 
 		private:
+			uint32_t ComputePlayableCardsMask() const
+			{
+				static_assert(state::board::Hand::max_cards_ <= 32);
+				auto const& hand = state_.GetCurrentPlayer().hand_;
+				uint32_t mask = 0;
+				for (size_t idx = 0; idx < hand.Size(); ++idx) {
+					if (IsPlayable(idx)) mask |= 1u << idx;
+				}
+				return mask;
+			}
+
 			bool CheckCost(state::CardRef card_ref, state::Cards::Card const& card) const
 			{
 				int cost = card.GetCost();
@@ -31,7 +31,7 @@ namespace engine {
 				{
 					Manipulate manipulate_;
 					state::CardRef card_ref_;
-					std::vector<state::CardRef> & new_targets;
+					CardRefChoices & new_targets;
 				};
 
 				struct AuraGetTarget
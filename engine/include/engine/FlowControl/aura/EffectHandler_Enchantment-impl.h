@@ -9,9 +9,9 @@ namespace engine {
 		{
 			template <typename EnchantmentType>
 			inline EffectHandler_Enchantment& EffectHandler_Enchantment::SetEnchantmentType() {
-				apply_on = [](contexts::AuraApplyOn const& context) {
+				Utils::CodeRegistry::Bind(apply_on, [](contexts::AuraApplyOn const& context) {
 					return context.manipulate_.Card(context.target_).Enchant().AddAuraEnchantment(EnchantmentType());
-				};
+				});
 				return *this;
 			}
 
@@ -25,7 +25,7 @@ namespace engine {
 
 				// check if enchantment vanished
 				if (applied_enchantment.first.IsValid()) {
-					if (!state.GetCard(applied_enchantment.first).GetRawData().enchantment_handler.Exists(applied_enchantment.second)) {
+					if (!state.GetCard(applied_enchantment.first).GetEnchantmentHandler().Exists(applied_enchantment.second)) {
 						applied_enchantment.first.Invalidate();
 					}
 				}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Utils/CodeRegistry.h"
+
 namespace engine {
 	namespace FlowControl {
 		class FlowContext;
@@ -17,11 +19,11 @@ namespace engine {
 
 				EffectHandler_Enchantment() : get_target(nullptr), apply_on(nullptr), applied_enchantment() {}
 
-				EffectHandler_Enchantment& SetGetTarget(FuncGetTarget* callback) { get_target = callback; return *this; }
+				template <typename Functor> EffectHandler_Enchantment& SetGetTarget(Functor const& callback) { Utils::CodeRegistry::Bind(get_target, callback); return *this; }
 
 				template <typename EnchantmentType> EffectHandler_Enchantment& SetEnchantmentType();
 
-				EffectHandler_Enchantment& SetApplyOn(FuncApplyOn* callback) { apply_on = callback; return *this; }
+				template <typename Functor> EffectHandler_Enchantment& SetApplyOn(Functor const& callback) { Utils::CodeRegistry::Bind(apply_on, callback); return *this; }
 
 				bool IsCallbackSet_GetTarget() const { return get_target != nullptr; }
 				bool IsCallbackSet_ApplyOn() const { return apply_on != nullptr; }
@@ -31,6 +33,22 @@ namespace engine {
 
 				void Update(state::State & state, FlowControl::FlowContext & flow_context, state::CardRef card_ref, bool aura_valid);
 
+				template <typename Writer>
+				void Save(Writer & writer) const {
+					writer.WriteCodePointer(get_target);
+					writer.WriteCodePointer(apply_on);
+					writer.WriteRaw(applied_enchantment.first);
+					writer.WriteRaw(applied_enchantment.second);
+				}
+
+				template <typename Reader>
+				void Load(Reader & reader) {
+					reader.ReadCodePointer(get_target);
+					reader.ReadCodePointer(apply_on);
+					reader.ReadRaw(applied_enchantment.first);
+					reader.ReadRaw(applied_enchantment.second);
+				}
+
 			private:
 				FuncGetTarget * get_target;
 				FuncApplyOn * apply_on;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include "engine/FlowControl/aura/EffectHandler_Enchantments.h"
 
 namespace engine {
@@ -9,9 +11,9 @@ namespace engine {
 		{
 			template <typename EnchantmentType>
 			inline EffectHandler_Enchantments& EffectHandler_Enchantments::SetEnchantmentType() {
-				apply_on = [](contexts::AuraApplyOn const& context) {
+				Utils::CodeRegistry::Bind(apply_on, [](contexts::AuraApplyOn const& context) {
 					return context.manipulate_.Card(context.target_).Enchant().AddAuraEnchantment(EnchantmentType());
-				};
+				});
 				return *this;
 			}
 
@@ -20,12 +22,12 @@ namespace engine {
 				assert(get_targets);
 				assert(apply_on);
 
-				std::vector<state::CardRef> new_targets;
+				CardRefChoices new_targets;
 				if (aura_valid) (*get_targets)({ Manipulate(state, flow_context), card_ref, new_targets });
 
-				for (auto it = applied_enchantments.begin(), it2 = applied_enchantments.end(); it != it2;)
+				for (auto it = applied_enchantments.begin(); it != applied_enchantments.end();)
 				{
-					if (!state.GetCard(it->first).GetRawData().enchantment_handler.Exists(it->second)) {
+					if (!state.GetCard(it->first).GetEnchantmentHandler().Exists(it->second)) {
 						// enchantment vanished
 						it = applied_enchantments.erase(it);
 						continue;
@@ -46,11 +48,12 @@ namespace engine {
 
 				for (auto new_target : new_targets) {
 					// enchantments should be applied
-					assert(applied_enchantments.find(new_target) == applied_enchantments.end());
+					auto id = (*apply_on)({ Manipulate(state, flow_context), card_ref, new_target });
 
-					applied_enchantments.insert(std::make_pair(new_target,
-						(*apply_on)({ Manipulate(state, flow_context), card_ref, new_target })
-					));
+					auto it = std::lower_bound(applied_enchantments.begin(), applied_enchantments.end(), new_target,
+						[](auto const& lhs, state::CardRef rhs) { return lhs.first.id < rhs.id; });
+					assert(it == applied_enchantments.end() || it->first != new_target);
+					applied_enchantments.insert(it, std::make_pair(new_target, id));
 				}
 			}
 		}
@@ -1,6 +1,9 @@
 #pragma once
 
-#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Utils/CodeRegistry.h"
 
 namespace engine {
 	namespace FlowControl {
@@ -19,11 +22,11 @@ namespace engine {
 
 				EffectHandler_Enchantments() : get_targets(nullptr), apply_on(nullptr), applied_enchantments() {}
 
-				EffectHandler_Enchantments& SetGetTargets(FuncGetTargets* callback) { get_targets = callback; return *this; }
+				template <typename Functor> EffectHandler_Enchantments& SetGetTargets(Functor const& callback) { Utils::CodeRegistry::Bind(get_targets, callback); return *this; }
 
 				template <typename EnchantmentType> EffectHandler_Enchantments& SetEnchantmentType();
 
-				EffectHandler_Enchantments& SetApplyOn(FuncApplyOn* callback) { apply_on = callback; return *this; }
+				template <typename Functor> EffectHandler_Enchantments& SetApplyOn(Functor const& callback) { Utils::CodeRegistry::Bind(apply_on, callback); return *this; }
 
 				bool IsCallbackSet_GetTargets() const { return get_targets != nullptr; }
 				bool IsCallbackSet_ApplyOn() const { return apply_on != nullptr; }
@@ -33,11 +36,40 @@ namespace engine {
 
 				void Update(state::State & state, FlowControl::FlowContext & flow_context, state::CardRef card_ref, bool aura_valid);
 
+				template <typename Writer>
+				void Save(Writer & writer) const {
+					writer.WriteCodePointer(get_targets);
+					writer.WriteCodePointer(apply_on);
+
+					writer.WriteSize(applied_enchantments.size());
+					for (auto const& item : applied_enchantments) {
+						writer.WriteRaw(item.first);
+						writer.WriteRaw(item.second);
+					}
+				}
+
+				template <typename Reader>
+				void Load(Reader & reader) {
+					reader.ReadCodePointer(get_targets);
+					reader.ReadCodePointer(apply_on);
+					applied_enchantments.clear();
+					size_t size = reader.ReadSize();
+					for (size_t i = 0; i < size; ++i) {
+						state::CardRef card_ref;
+						enchantment::TieredEnchantments::IdentifierType id;
+						reader.ReadRaw(card_ref);
+						reader.ReadRaw(id);
+						applied_enchantments.push_back(std::make_pair(card_ref, id)); // saved in order
+					}
+				}
+
 			private:
 				FuncGetTargets * get_targets;
 				FuncApplyOn * apply_on;
 
-				std::unordered_map<state::CardRef, enchantment::TieredEnchantments::IdentifierType> applied_enchantments;
+				// Ordered by the target's card id
+				// A vector is used, so a copy-assigned handler reuses the buffer
+				std::vector<std::pair<state::CardRef, enchantment::TieredEnchantments::IdentifierType>> applied_enchantments;
 			};
 		}
 	}
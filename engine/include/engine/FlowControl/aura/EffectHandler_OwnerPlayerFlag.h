@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Utils/CodeRegistry.h"
+
 namespace engine {
 	namespace FlowControl {
 		class FlowContext;
@@ -17,8 +19,8 @@ namespace engine {
 
 				EffectHandler_OwnerPlayerFlag() : apply_on(nullptr), remove_from(nullptr), applied_player() {}
 
-				EffectHandler_OwnerPlayerFlag& SetApplyOn(FuncApplyOn* callback) { apply_on = callback; return *this; }
-				EffectHandler_OwnerPlayerFlag& SetRemoveFrom(FuncRemoveFrom* callback) { remove_from = callback; return *this; }
+				template <typename Functor> EffectHandler_OwnerPlayerFlag& SetApplyOn(Functor const& callback) { Utils::CodeRegistry::Bind(apply_on, callback); return *this; }
+				template <typename Functor> EffectHandler_OwnerPlayerFlag& SetRemoveFrom(Functor const& callback) { Utils::CodeRegistry::Bind(remove_from, callback); return *this; }
 
 				bool IsCallbackSet_ApplyOn() const { return apply_on != nullptr; }
 				bool IsCallbackSet_RemoveFrom() const { return remove_from != nullptr; }
@@ -28,6 +30,20 @@ namespace engine {
 
 				void Update(state::State & state, FlowControl::FlowContext & flow_context, state::CardRef card_ref, bool aura_valid);
 
+				template <typename Writer>
+				void Save(Writer & writer) const {
+					writer.WriteCodePointer(apply_on);
+					writer.WriteCodePointer(remove_from);
+					writer.WriteRaw(applied_player);
+				}
+
+				template <typename Reader>
+				void Load(Reader & reader) {
+					reader.ReadCodePointer(apply_on);
+					reader.ReadCodePointer(remove_from);
+					reader.ReadRaw(applied_player);
+				}
+
 			private:
 				FuncApplyOn * apply_on;
 				FuncRemoveFrom * remove_from;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stdint.h>
 #include <variant>
 #include "state/targetor/Targets.h"
 #include "engine/FlowControl/enchantment/TieredEnchantments.h"
@@ -64,6 +65,43 @@ namespace engine {
 					}, effect_);
 				}
 
+				template <typename Writer>
+				void Save(Writer & writer) const {
+					writer.WriteRaw(first_time_update_);
+					writer.WriteRaw(last_updated_change_id_first_player_minions_);
+					writer.WriteRaw(last_updated_change_id_second_player_minions_);
+					writer.WriteRaw(last_updated_undamaged_);
+					writer.WriteRaw(last_updated_owner_);
+					writer.WriteRaw(owner_ref_);
+					writer.WriteRaw(update_policy_);
+					writer.WriteRaw(emit_policy_);
+					writer.WriteRaw((uint8_t)effect_.index());
+					std::visit([&](auto const& item) { item.Save(writer); }, effect_);
+				}
+
+				template <typename Reader>
+				void Load(Reader & reader) {
+					reader.ReadRaw(first_time_update_);
+					reader.ReadRaw(last_updated_change_id_first_player_minions_);
+					reader.ReadRaw(last_updated_change_id_second_player_minions_);
+					reader.ReadRaw(last_updated_undamaged_);
+					reader.ReadRaw(last_updated_owner_);
+					reader.ReadRaw(owner_ref_);
+					reader.ReadRaw(update_policy_);
+					reader.ReadRaw(emit_policy_);
+					uint8_t index;
+					reader.ReadRaw(index);
+					switch (index) {
+					case 0: effect_.emplace<0>(); break;
+					case 1: effect_.emplace<1>(); break;
+					case 2: effect_.emplace<2>(); break;
+					case 3: effect_.emplace<3>(); break;
+					default: reader.Check(false);
+					}
+					static_assert(std::variant_size_v<decltype(effect_)> == 4);
+					std::visit([&](auto& item) { item.Load(reader); }, effect_);
+				}
+
 			private:
 				bool NeedUpdate(state::State & state, FlowControl::FlowContext & flow_context);
 				void AfterUpdated(state::State & state, FlowControl::FlowContext & flow_context);
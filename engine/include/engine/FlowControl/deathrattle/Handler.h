@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Utils/CodeRegistry.h"
 #include "state/Types.h"
 #include "state/targetor/TargetsGenerator.h"
 
@@ -45,8 +46,10 @@ namespace engine {
 					deathrattles_.clear();
 				}
 
-				void Add(DeathrattleCallback* deathrattle) {
-					deathrattles_.push_back(deathrattle);
+				// A captureless lambda, registered in Utils::CodeRegistry
+				template <typename Functor>
+				void Add(Functor const& deathrattle) {
+					deathrattles_.push_back(Utils::CodeRegistry::Bind<DeathrattleCallback*>(deathrattle));
 				}
 
 				void TriggerAll(context::Deathrattle const& context) const {
@@ -60,6 +63,24 @@ namespace engine {
 					}
 				}
 
+				// The borrowed deathrattles are written first, as they are triggered first
+				template <typename Writer>
+				void Save(Writer & writer) const {
+					size_t base_size = base_deathrattles_ ? base_deathrattles_->size() : 0;
+					writer.WriteSize(base_size + deathrattles_.size());
+					if (base_deathrattles_) {
+						for (auto deathrattle : *base_deathrattles_) writer.WriteCodePointer(deathrattle);
+					}
+					for (auto deathrattle : deathrattles_) writer.WriteCodePointer(deathrattle);
+				}
+
+				template <typename Reader>
+				void Load(Reader & reader) {
+					base_deathrattles_ = nullptr;
+					deathrattles_.resize(reader.ReadSize());
+					for (auto & deathrattle : deathrattles_) reader.ReadCodePointer(deathrattle);
+				}
+
 			private:
 				typedef std::vector<DeathrattleCallback*> Deathrattles;
 				Deathrattles const* base_deathrattles_;
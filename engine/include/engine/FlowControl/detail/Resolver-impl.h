@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include "state/State.h"
 #include "engine/FlowControl/FlowContext.h"
 #include "engine/FlowControl/Manipulate.h"
@@ -17,8 +19,7 @@ namespace engine {
 					auto first_minions_change_id = state.GetBoard().GetFirst().minions_.GetChangeId();
 					auto second_minions_change_id = state.GetBoard().GetSecond().minions_.GetChangeId();
 
-					UpdateAura(state, flow_context); // update aura first, since aura will add/remove enchantments on others
-					UpdateEnchantments(state, flow_context);
+					UpdateAuraAndEnchantments(state, flow_context);
 
 					do {
 						if (!CreateDeaths(state, flow_context)) return false;
@@ -104,7 +105,10 @@ namespace engine {
 					int zone_pos = card.GetZonePosition();
 					int attack = card.GetAttack();
 
-					ordered_deaths_.insert(std::make_pair(card.GetPlayOrder(),
+					int play_order = card.GetPlayOrder();
+					auto it = std::upper_bound(ordered_deaths_.begin(), ordered_deaths_.end(), play_order,
+						[](int lhs, auto const& rhs) { return lhs < rhs.first; });
+					ordered_deaths_.insert(it, std::make_pair(play_order,
 						DeathProcessor(ref, player, zone, zone_pos, attack)));
 				}
 
@@ -126,6 +130,33 @@ namespace engine {
 				return false;
 			}
 
+			inline Resolver::UpdateKey Resolver::GetUpdateKey(state::State const& state)
+			{
+				return UpdateKey{
+					state.GetCardsManager().GetChangeId(),
+					state.GetBoard().GetFirst().minions_.GetChangeId(),
+					state.GetBoard().GetSecond().minions_.GetChangeId(),
+					state.GetTurn(),
+					state.GetCurrentPlayerId().GetSide()
+				};
+			}
+
+			inline void Resolver::UpdateAuraAndEnchantments(state::State & state, FlowContext & flow_context)
+			{
+				UpdateKey key = GetUpdateKey(state);
+				if (updated_key_valid_ && key == updated_key_) {
+					CheckSkippedUpdate(state, flow_context);
+					return;
+				}
+
+				UpdateAura(state, flow_context); // update aura first, since aura will add/remove enchantments on others
+				UpdateEnchantments(state, flow_context);
+
+				// If anything changed, the auras might see a different board next time
+				updated_key_ = GetUpdateKey(state);
+				updated_key_valid_ = (updated_key_ == key);
+			}
+
 			inline void Resolver::UpdateAura(state::State & state, FlowContext & flow_context)
 			{
 				state.GetAuraManager().ForEachAura([&state, &flow_context](FlowControl::aura::Handler & handler)
@@ -146,20 +177,55 @@ namespace engine {
 
 			inline void Resolver::UpdateEnchantments(state::State & state, FlowContext & flow_context, state::PlayerIdentifier player)
 			{
+				state::CardRef hero_ref = state.GetBoard().Get(player).GetHeroRef();
 				state::CardRef weapon_ref = state.GetBoard().Get(player).GetWeaponRef();
 
-				Manipulate(state, flow_context).Hero(player).Enchant().Update();
+				if (NeedUpdateEnchantments(state, hero_ref)) {
+					Manipulate(state, flow_context).Hero(player).Enchant().Update();
+				}
 
-				if (weapon_ref.IsValid()) {
+				if (weapon_ref.IsValid() && NeedUpdateEnchantments(state, weapon_ref)) {
 					Manipulate(state, flow_context).Weapon(weapon_ref).Enchant().Update();
 				}
 
 				// need to cache first, since minion might be removed from the container
 				minions_refs_ = state.GetBoard().Get(player).minions_.GetAll();
 				for (state::CardRef minion_ref : minions_refs_) {
+					if (!NeedUpdateEnchantments(state, minion_ref)) continue;
 					Manipulate(state, flow_context).OnBoardMinion(minion_ref).Enchant().Update();
 				}
 			}
+
+			// Checked on the read-only card, so a borrowed card is not copied (on write) for nothing
+			inline bool Resolver::NeedUpdateEnchantments(state::State const& state, state::CardRef card_ref)
+			{
+				return state.GetCard(card_ref).GetEnchantmentHandler().NeedUpdate(state);
+			}
+
+			// Run the full update on a copy; nothing should change
+			inline void Resolver::CheckSkippedUpdate(state::State const& state, FlowContext const& flow_context)
+			{
+#ifndef NDEBUG
+				// The scratch copies are reused, so this check does not allocate once they have grown
+				static thread_local state::State full_state;
+				static thread_local FlowContext full_flow_context;
+				full_state = state;
+				full_flow_context = flow_context;
+				Resolver full_resolver;
+				full_resolver.UpdateAura(full_state, full_flow_context);
+				full_resolver.UpdateEnchantments(full_state, full_flow_context);
+
+				assert(full_state.GetCardsManager().GetCount() == state.GetCardsManager().GetCount());
+				state.GetCardsManager().ForEach([&](state::CardRef ref, state::Cards::Card const& card) {
+					state::Cards::Card const& full_card = full_state.GetCard(ref);
+					assert(full_card.GetZone() == card.GetZone());
+					assert(full_card.GetRawData().enchanted_states == card.GetRawData().enchanted_states);
+					assert(full_card.GetHP() == card.GetHP());
+					(void)full_card;
+					return true;
+				});
+#endif
+			}
 		}
 	}
 }
\ No newline at end of file
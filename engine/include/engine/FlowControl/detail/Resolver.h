@@ -1,8 +1,10 @@
 #pragma once
 
 #include <unordered_set>
-#include <map>
+#include <utility>
+#include <vector>
 #include "engine/Result.h"
+#include "state/board/Minions.h"
 
 namespace state {
 	class State;
@@ -18,10 +20,16 @@ namespace engine {
 			class Resolver
 			{
 			public:
-				Resolver() : deaths_(), ordered_deaths_(), minions_refs_() {}
+				Resolver() :
+					deaths_(), ordered_deaths_(), minions_refs_(),
+					updated_key_(), updated_key_valid_(false)
+				{}
 
 				bool Resolve(state::State & state, FlowContext & flow_context);
 
+				// Forget the last update, e.g., if the state is modified outside of the flow
+				void Reset() { updated_key_valid_ = false; }
+
 			private:
 				class DeathProcessor {
 				public:
@@ -44,14 +52,42 @@ namespace engine {
 				bool SetResult(FlowContext & flow_context, engine::Result result);
 
 			private:
+				// The auras and the enchantments only depend on the cards, the minions' order, and the turn.
+				//    So if none of them changed since an update which did nothing, the update is skipped.
+				// The cards are modified only through Cards::Manager::GetMutable(), which bumps the change id.
+				struct UpdateKey {
+					int cards_change_id;
+					int first_minions_change_id;
+					int second_minions_change_id;
+					int turn;
+					state::PlayerSide current_player;
+
+					bool operator==(UpdateKey const& rhs) const {
+						return cards_change_id == rhs.cards_change_id &&
+							first_minions_change_id == rhs.first_minions_change_id &&
+							second_minions_change_id == rhs.second_minions_change_id &&
+							turn == rhs.turn &&
+							current_player == rhs.current_player;
+					}
+					bool operator!=(UpdateKey const& rhs) const { return !(*this == rhs); }
+				};
+				static UpdateKey GetUpdateKey(state::State const& state);
+
+				void UpdateAuraAndEnchantments(state::State & state, FlowContext & flow_context);
 				void UpdateAura(state::State & state, FlowContext & flow_context);
 				void UpdateEnchantments(state::State & state, FlowContext & flow_context);
 				void UpdateEnchantments(state::State & state, FlowContext & flow_context, state::PlayerIdentifier player);
+				static bool NeedUpdateEnchantments(state::State const& state, state::CardRef card_ref);
+
+				// Debug builds compare the skipped updates with a full update
+				static void CheckSkippedUpdate(state::State const& state, FlowContext const& flow_context);
 
 			private:
 				std::vector<state::CardRef> deaths_;
-				std::multimap<int, DeathProcessor> ordered_deaths_;
-				std::vector<state::CardRef> minions_refs_; // a cache for process
+				std::vector<std::pair<int, DeathProcessor>> ordered_deaths_; // ordered by play order
+				state::board::Minions::Container minions_refs_; // a cache for process
+				UpdateKey updated_key_;
+				bool updated_key_valid_;
 			};
 		}
 	}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stdint.h>
 #include <functional>
 #include <utility>
 #include <memory>
@@ -210,6 +211,7 @@ namespace engine {
 				void ApplyAll(state::State const& state, FlowContext & flow_context, state::CardRef card_ref, state::Cards::EnchantableStates & stats)
 				{
 					// try read-only version first. if failed, try mutable one.
+					state::Cards::EnchantableStates const origin_stats = stats;
 					bool success = true;
 					GetEnchantmentsForRead().IterateAll([&](IdentifierType id, EnchantmentType const& enchantment) -> bool {
 						std::visit([&](auto&& arg) {
@@ -223,6 +225,8 @@ namespace engine {
 					if (success) return;
 
 					// Some enchantment should be removed. Retry with mutable one.
+					// Start over, since the enchantments before the failed one are already applied
+					stats = origin_stats;
 					GetEnchantmentsForWrite().IterateAll([&](IdentifierType id, EnchantmentType const& enchantment) -> bool {
 						std::visit([&](auto&& arg) {
 							if (!arg.Apply(ApplyFunctorContext{ state, flow_context, card_ref, &stats })) {
@@ -242,6 +246,66 @@ namespace engine {
 					update_decider_.FinishedUpdate(state);
 				}
 
+			public: // archive
+				template <typename Writer>
+				void Save(Writer & writer) const {
+					GetEnchantmentsForRead().Save(writer, [](Writer & writer, EnchantmentType const& enchantment) {
+						writer.WriteRaw((uint8_t)enchantment.index());
+						if (auto item = std::get_if<NormalEnchantment>(&enchantment)) {
+							writer.WriteCodePointer(item->apply_functor);
+							writer.WriteRaw(item->valid_until_turn);
+							writer.WriteRaw(item->force_update_every_time);
+						}
+						else if (auto item = std::get_if<AuraEnchantment>(&enchantment)) {
+							writer.WriteCodePointer(item->apply_functor);
+							writer.WriteRaw(item->force_update_every_time);
+						}
+						else {
+							auto const& hooked = std::get<EventHookedEnchantment>(enchantment);
+							writer.WriteCodePointer(hooked.apply_functor);
+							writer.WriteCodePointer(hooked.register_functor);
+							writer.WriteRaw(hooked.aux_data.valid);
+							writer.WriteRaw(hooked.aux_data.player);
+						}
+					});
+					update_decider_.Save(writer);
+				}
+
+				template <typename Reader>
+				void Load(Reader & reader) {
+					base_enchantments_ = nullptr;
+					enchantments_.Load(reader, [](Reader & reader) -> EnchantmentType {
+						uint8_t index;
+						reader.ReadRaw(index);
+						ApplyFunctor apply_functor;
+						reader.ReadCodePointer(apply_functor);
+						switch (index) {
+						case 0: {
+							int valid_until_turn;
+							bool force_update_every_time;
+							reader.ReadRaw(valid_until_turn);
+							reader.ReadRaw(force_update_every_time);
+							return NormalEnchantment(apply_functor, valid_until_turn, force_update_every_time);
+						}
+						case 1: {
+							bool force_update_every_time;
+							reader.ReadRaw(force_update_every_time);
+							return AuraEnchantment(apply_functor, force_update_every_time);
+						}
+						default: {
+							reader.Check(index == 2);
+							EventHookedEnchantment::RegisterEventFunctor register_functor;
+							EventHookedEnchantment::AuxData aux_data;
+							reader.ReadCodePointer(register_functor);
+							reader.ReadRaw(aux_data.valid);
+							reader.ReadRaw(aux_data.player);
+							return EventHookedEnchantment(apply_functor, register_functor, aux_data);
+						}
+						}
+					});
+					update_decider_.Load(reader);
+				}
+
 			private:
 				ContainerType const& GetEnchantmentsForRead() const {
 					if (base_enchantments_) return *base_enchantments_;
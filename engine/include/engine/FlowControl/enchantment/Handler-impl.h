@@ -17,7 +17,7 @@ namespace engine {
 			inline void Handler::Update(state::State & state, FlowContext & flow_context, state::CardRef card_ref, bool allow_hp_reduce) {
 				if (!enchantments.NeedUpdate(state)) return;
 
-				auto GetCard = [&]() { return state.GetCard(card_ref); };
+				auto GetCard = [&]() -> state::Cards::Card const& { return state.GetCard(card_ref); };
 
 				int origin_hp = GetCard().GetHP();
 
@@ -62,9 +62,9 @@ namespace engine {
 			inline void Handler::UpdateCard(state::State & state, FlowContext & flow_context, state::CardRef card_ref, state::Cards::EnchantableStates const & new_states)
 			{
 				static_assert(state::Cards::EnchantableStates::kFieldChangeId == 17, "enchantable fields changed");
-				auto GetCard = [&]() { return state.GetCard(card_ref); };
+				auto GetCard = [&]() -> state::Cards::Card const& { return state.GetCard(card_ref); };
 
-				state::Cards::EnchantableStates const& current_states = GetCard().GetRawData().enchanted_states;
+				state::Cards::EnchantableStates const current_states = GetCard().GetRawData().enchanted_states;
 
 				auto card_manipulator = Manipulators::CardManipulator(state, flow_context, card_ref);
 
@@ -77,9 +77,9 @@ namespace engine {
 			inline void Handler::UpdateCharacter(state::State & state, FlowContext & flow_context, state::CardRef card_ref, state::Cards::EnchantableStates const& new_states)
 			{
 				static_assert(state::Cards::EnchantableStates::kFieldChangeId == 17, "enchantable fields changed");
-				auto GetCard = [&]() { return state.GetCard(card_ref); };
+				auto GetCard = [&]() -> state::Cards::Card const& { return state.GetCard(card_ref); };
 
-				state::Cards::EnchantableStates const& current_states = GetCard().GetRawData().enchanted_states;
+				state::Cards::EnchantableStates const current_states = GetCard().GetRawData().enchanted_states;
 
 				UpdateCard(state, flow_context, card_ref, new_states);
 
@@ -126,8 +126,8 @@ namespace engine {
 			inline void Handler::UpdateMinion(state::State & state, FlowContext & flow_context, state::CardRef card_ref, state::Cards::EnchantableStates const& new_states)
 			{
 				static_assert(state::Cards::EnchantableStates::kFieldChangeId == 17, "enchantable fields changed");
-				auto GetCard = [&]() { return state.GetCard(card_ref); };
-				state::Cards::EnchantableStates const& current_states = GetCard().GetRawData().enchanted_states;
+				auto GetCard = [&]() -> state::Cards::Card const& { return state.GetCard(card_ref); };
+				state::Cards::EnchantableStates const current_states = GetCard().GetRawData().enchanted_states;
 
 				UpdateCharacter(state, flow_context, card_ref, new_states);
 
@@ -169,8 +169,8 @@ namespace engine {
 			inline void Handler::UpdateWeapon(state::State & state, FlowContext & flow_context, state::CardRef card_ref, state::Cards::EnchantableStates const& new_states)
 			{
 				static_assert(state::Cards::EnchantableStates::kFieldChangeId == 17, "enchantable fields changed");
-				auto GetCard = [&]() { return state.GetCard(card_ref); };
-				state::Cards::EnchantableStates const& current_states = GetCard().GetRawData().enchanted_states;
+				auto GetCard = [&]() -> state::Cards::Card const& { return state.GetCard(card_ref); };
+				state::Cards::EnchantableStates const current_states = GetCard().GetRawData().enchanted_states;
 
 				UpdateCard(state, flow_context, card_ref, new_states);
 
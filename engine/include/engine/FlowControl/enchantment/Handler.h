@@ -81,8 +81,22 @@ namespace engine {
 				void AfterCopied(FlowControl::Manipulate const& manipulate, state::CardRef card_ref) { enchantments.AfterCopied(manipulate, card_ref); }
 				void Remove(TieredEnchantments::IdentifierType id) { return enchantments.Remove(id); }
 
+				bool NeedUpdate(state::State const& state) const { return enchantments.NeedUpdate(state); }
 				void Update(state::State & state, FlowContext & flow_context, state::CardRef card_ref, bool allow_hp_reduce);
 
+				template <typename Writer>
+				void Save(Writer & writer) const {
+					GetOriginalStates().Save(writer);
+					enchantments.Save(writer);
+				}
+
+				template <typename Reader>
+				void Load(Reader & reader) {
+					base_origin_states = nullptr;
+					origin_states.Load(reader);
+					enchantments.Load(reader);
+				}
+
 			private:
 				void UpdateHero(state::State & state, FlowContext & flow_context, state::CardRef card_ref, state::Cards::EnchantableStates const& new_states);
 				void UpdateMinion(state::State & state, FlowContext & flow_context, state::CardRef card_ref, state::Cards::EnchantableStates const& new_states);
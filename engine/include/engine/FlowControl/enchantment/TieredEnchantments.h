@@ -114,7 +114,7 @@ namespace engine {
 					tier3_.ApplyAll(state, flow_context, card_ref, stats);
 				}
 
-				bool NeedUpdate(state::State & state) const {
+				bool NeedUpdate(state::State const& state) const {
 					if (tier1_.NeedUpdate(state)) return true;
 					if (tier2_.NeedUpdate(state)) return true;
 					if (tier3_.NeedUpdate(state)) return true;
@@ -127,6 +127,20 @@ namespace engine {
 					tier3_.FinishedUpdate(state);
 				}
 
+				template <typename Writer>
+				void Save(Writer & writer) const {
+					tier1_.Save(writer);
+					tier2_.Save(writer);
+					tier3_.Save(writer);
+				}
+
+				template <typename Reader>
+				void Load(Reader & reader) {
+					tier1_.Load(reader);
+					tier2_.Load(reader);
+					tier3_.Load(reader);
+				}
+
 			private:
 				template <int Tier> Enchantments & GetEnchantments();
 				template <int Tier> const Enchantments & GetEnchantments() const;
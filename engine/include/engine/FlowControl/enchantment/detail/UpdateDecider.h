@@ -20,6 +20,20 @@ namespace engine {
 					void FinishedUpdate(state::State const& state);
 					bool NeedUpdate(state::State const& state) const;
 
+					template <typename Writer>
+					void Save(Writer & writer) const {
+						writer.WriteRaw(item_changed_);
+						writer.WriteRaw(need_update_after_turn_);
+						writer.WriteRaw(force_update_items_);
+					}
+
+					template <typename Reader>
+					void Load(Reader & reader) {
+						reader.ReadRaw(item_changed_);
+						reader.ReadRaw(need_update_after_turn_);
+						reader.ReadRaw(force_update_items_);
+					}
+
 				private:
 					bool item_changed_;
 					int need_update_after_turn_;
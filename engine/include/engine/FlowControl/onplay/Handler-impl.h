@@ -29,13 +29,7 @@ namespace engine {
 
 					if (context.NeedToPrepareTarget() && !context.IsAllowedNoTarget()) {
 						state::targetor::Targets targets_rule = context.GetTargets();
-						std::vector<state::CardRef> targets;
-						bool targets_empty = true;
-						targets_rule.ForEach(state, [&](...) {
-							targets_empty = false;
-							return false;
-						});
-						if (targets_empty) return false;
+						if (targets_rule.GetTargetSet(state).Empty()) return false;
 					}
 				}
 
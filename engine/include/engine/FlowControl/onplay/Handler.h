@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Utils/CodeRegistry.h"
 #include "engine/FlowControl/FlowContext.h"
 
 namespace engine {
@@ -25,16 +26,36 @@ namespace engine {
 
 				Handler() : check_playable(nullptr), choose_one(nullptr), specified_target_getter(nullptr), onplay(nullptr) {}
 
-				void SetCheckPlayableCallback(CheckPlayableCallback* callback) { check_playable = callback; }
-				void SetChooseOneOptionsCallback(GetChooseOneOptionsCallback * callback) { choose_one = callback; }
-				void SetOnPlayCallback(OnPlayCallback* callback) { onplay = callback; }
-				void SetSpecifyTargetCallback(SpecifiedTargetGetter* callback) { specified_target_getter = callback; }
+				// The callbacks are captureless lambdas, registered in Utils::CodeRegistry
+				template <typename Functor> void SetCheckPlayableCallback(Functor const& callback) { Utils::CodeRegistry::Bind(check_playable, callback); }
+				template <typename Functor> void SetChooseOneOptionsCallback(Functor const& callback) { Utils::CodeRegistry::Bind(choose_one, callback); }
+				template <typename Functor> void SetOnPlayCallback(Functor const& callback) { Utils::CodeRegistry::Bind(onplay, callback); }
+				template <typename Functor> void SetSpecifyTargetCallback(Functor const& callback) { Utils::CodeRegistry::Bind(specified_target_getter, callback); }
+
+				// No callback registered; playing the card has no effect of its own
+				bool Empty() const { return !check_playable && !choose_one && !specified_target_getter && !onplay; }
 
 			public:
 				bool CheckPlayable(state::State const& state, state::PlayerIdentifier player, state::CardRef card_ref) const;
 				void PrepareTarget(state::State & state, FlowContext & flow_context, state::PlayerIdentifier player, state::CardRef card_ref) const;
 				void OnPlay(state::State & state, FlowContext & flow_context, state::PlayerIdentifier player, state::CardRef card_ref, state::CardRef * new_card_ref) const;
 
+				template <typename Writer>
+				void Save(Writer & writer) const {
+					writer.WriteCodePointer(check_playable);
+					writer.WriteCodePointer(choose_one);
+					writer.WriteCodePointer(specified_target_getter);
+					writer.WriteCodePointer(onplay);
+				}
+
+				template <typename Reader>
+				void Load(Reader & reader) {
+					reader.ReadCodePointer(check_playable);
+					reader.ReadCodePointer(choose_one);
+					reader.ReadCodePointer(specified_target_getter);
+					reader.ReadCodePointer(onplay);
+				}
+
 			private:
 				void PrepareChooseOne(state::State & state, FlowContext & flow_context) const;
 
@@ -27,25 +27,57 @@ namespace engine
 		};
 
 	public:
+		Game() : state_(), flow_context_(), undo_enabled_(false), journal_() {}
+
+		// A copy starts with undo disabled, since the journal of 'rhs' is not copied
+		Game(Game const& rhs) : state_(rhs.state_), flow_context_(), undo_enabled_(false), journal_() {}
+		Game & operator=(Game const& rhs) {
+			state_ = rhs.state_;
+			undo_enabled_ = false;
+			journal_.Clear();
+			return *this;
+		}
+
 		void SetStartState(state::State const& state) {
 			state_ = state;
+			journal_.Clear();
 		}
 
 		state::State const& GetCurrentState() const { return state_; }
 
 		Result PerformAction(engine::IActionParameterGetter & action_cb) {
 			RandomGenerator random_cb(action_cb);
-			FlowControl::FlowContext flow_context(random_cb, action_cb);
-			FlowControl::FlowController flow_controller(state_, flow_context);
+			flow_context_.SetCallback(random_cb, action_cb);
+			FlowControl::FlowController flow_controller(state_, flow_context_);
+			if (undo_enabled_) return flow_controller.PerformAction(journal_);
 			return flow_controller.PerformAction();
 		}
 
+	public: // undo
+		// If enabled, the actions performed afterwards can be undone by Undo()
+		void SetUndoEnabled(bool enabled) {
+			undo_enabled_ = enabled;
+			if (!enabled) journal_.Clear();
+		}
+
+		bool CanUndo() const { return !journal_.Empty(); }
+
+		// Restore the state before the last action
+		void Undo() {
+			assert(CanUndo());
+			journal_.Undo(state_);
+		}
+
 	public:
 		void RefCopyFrom(Game const& rhs) {
 			state_.RefCopy(rhs.state_);
+			journal_.Clear();
 		}
 
 	private:
 		state::State state_;
+		FlowControl::FlowContext flow_context_; // reused, so its buffers are kept across actions
+		bool undo_enabled_;
+		state::UndoJournal journal_;
 	};
 }
\ No newline at end of file
@@ -38,7 +38,7 @@ namespace engine {
 			return main_ops[main_op_idx];
 		}
 
-		state::CardRef GetDefender(std::vector<state::CardRef> const& targets) final
+		state::CardRef GetDefender(FlowControl::CardRefChoices const& targets) final
 		{
 			assert(!targets.empty());
 			int size = (int)targets.size();
@@ -58,7 +58,7 @@ namespace engine {
 
 		state::CardRef GetSpecifiedTarget(
 			state::State & state, state::CardRef card_ref,
-			std::vector<state::CardRef> const& targets) final
+			FlowControl::CardRefChoices const& targets) final
 		{
 			if (targets.empty()) return state::CardRef();
 			int size = (int)targets.size();
@@ -67,7 +67,7 @@ namespace engine {
 			return targets[idx];
 		}
 
-		Cards::CardId ChooseOne(std::vector<Cards::CardId> const& cards) final
+		Cards::CardId ChooseOne(FlowControl::CardIdChoices const& cards) final
 		{
 			assert(!cards.empty());
 			assert(cards.size() > 1);
@@ -0,0 +1,17 @@
+#pragma once
+
+// The engine is header-only by default: the programs include the -impl headers (e.g., "engine/Game-impl.h"),
+//    and compile "Cards/CardDispatcher-impl.h" in one translation unit.
+// It can also be compiled once as a library (engine/src/hsengine.cpp; see engine/build/gcc7/hsengine):
+//    * The library defines HSENGINE_BUILD_LIBRARY, so the entry points below are not inline, and are exported.
+//    * The programs include "engine/Engine.h" only (no -impl headers), and link with libhsengine.a.
+// Entry points:
+//    engine::FlowControl::FlowController::PerformAction()
+//    engine::ValidActionAnalyzer::Analyze()
+//    Cards::CardDispatcher::CreateInstance() and GetPrototype() (always out-of-line)
+
+#ifdef HSENGINE_BUILD_LIBRARY
+#define HSENGINE_ENTRY_POINT
+#else
+#define HSENGINE_ENTRY_POINT inline
+#endif
@@ -1,14 +1,15 @@
 #pragma once
 
+#include "engine/Library.h"
 #include "engine/ValidActionAnalyzer.h"
 #include "engine/FlowControl/ValidActionGetter.h"
 
 namespace engine {
-	inline void ValidActionAnalyzer::Analyze(state::State const& game_state) {
+	HSENGINE_ENTRY_POINT void ValidActionAnalyzer::Analyze(state::State const& game_state) {
 		return Analyze(FlowControl::ValidActionGetter(game_state));
 	}
 	
-	inline void ValidActionAnalyzer::Analyze(FlowControl::ValidActionGetter const& getter) {
+	HSENGINE_ENTRY_POINT void ValidActionAnalyzer::Analyze(FlowControl::ValidActionGetter const& getter) {
 		Reset();
 
 		playable_cards_.clear();
@@ -1,8 +1,8 @@
 #pragma once
 
 #include <array>
-#include <vector>
 
+#include "Utils/FixedCapacityVector.h"
 #include "state/State.h"
 #include "engine/MainOp.h"
 
@@ -71,8 +71,8 @@ namespace engine {
 	private:
 		std::array<engine::MainOpType, engine::MainOpType::kMainOpMax> op_map_;
 		size_t op_map_size_;
-		std::vector<int> attackers_;
+		Utils::FixedCapacityVector<int, 8> attackers_; // hero and minions
 		std::array<state::CardRef, 8> attacker_indics_;
-		std::vector<size_t> playable_cards_;
+		Utils::FixedCapacityVector<size_t, state::board::Hand::max_cards_> playable_cards_;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "Utils/BinaryArchive.h"
+#include "state/State.h"
+
+namespace state
+{
+	// A compact binary encoding of a state; used to snapshot states in a search, or to pass them
+	//    to another process
+	// Unlike state::JsonSerializer, everything is kept (e.g., enchantments, event handlers, and auras),
+	//    so the decoded state is playable.
+	// The callbacks are encoded as the ids in Utils::CodeRegistry, so the data can be decoded by another
+	//    build of the same cards. The header carries a fingerprint of the structure layouts to check this.
+	class BinarySerializer
+	{
+	public:
+		static constexpr uint32_t kMagic = 0x53454e48; // "HNES"
+		static constexpr uint32_t kVersion = 2;
+
+		// The data is appended to 'buffer'
+		static void Serialize(State const& state, std::vector<uint8_t> & buffer) {
+			Utils::BinaryWriter writer(buffer);
+			writer.WriteRaw(kMagic);
+			writer.WriteRaw(kVersion);
+			writer.WriteRaw(GetBuildFingerprint());
+			state.Save(writer);
+		}
+
+		// Throws std::runtime_error if the data is malformed, or if it comes from another version or build
+		static void Deserialize(uint8_t const* data, size_t size, State & state) {
+			Utils::BinaryReader reader(data, size);
+
+			uint32_t magic;
+			uint32_t version;
+			uint64_t fingerprint;
+			reader.ReadRaw(magic);
+			reader.ReadRaw(version);
+			reader.ReadRaw(fingerprint);
+			if (magic != kMagic) throw std::runtime_error("not a binary state");
+			if (version != kVersion) throw std::runtime_error("binary state version mismatch");
+			if (fingerprint != GetBuildFingerprint()) throw std::runtime_error("binary state comes from an incompatible build");
+
+			state.Load(reader);
+			reader.Check(reader.AtEnd());
+		}
+
+		static void Deserialize(std::vector<uint8_t> const& buffer, State & state) {
+			Deserialize(buffer.data(), buffer.size(), state);
+		}
+
+		// The sizes of a few structures
+		static uint64_t GetBuildFingerprint() {
+			uint64_t fingerprint = sizeof(State);
+			fingerprint = fingerprint * 1000003 + sizeof(Cards::CardStates);
+			fingerprint = fingerprint * 1000003 + sizeof(Cards::CardHandlers);
+			fingerprint = fingerprint * 1000003 + sizeof(board::PlayerResource);
+			return fingerprint;
+		}
+	};
+}
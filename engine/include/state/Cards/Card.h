@@ -46,7 +46,7 @@ namespace state
 		public:
 			class ZoneSetter {
 			public:
-				ZoneSetter(CardData & data) : data_(data) {}
+				ZoneSetter(CardStates & data) : data_(data) {}
 				void operator()(PlayerIdentifier player, CardZone new_zone) {
 					data_.enchanted_states.player = player;
 					Zone(new_zone);
@@ -55,7 +55,7 @@ namespace state
 					data_.zone = new_zone;
 				}
 			private:
-				CardData & data_;
+				CardStates & data_;
 			};
 
 			class ZonePosSetter {
@@ -63,13 +63,13 @@ namespace state
 				template <CardZone, CardType> friend class state::ZoneChanger;
 				template <CardType TargetCardType, CardZone TargetCardZone> friend struct state::detail::PlayerDataStructureMaintainer;
 			public:
-				ZonePosSetter(CardData & data) : data_(data) {}
+				ZonePosSetter(CardStates & data) : data_(data) {}
 			private:
 				void operator()(int pos) {
 					data_.zone_position = pos;
 				}
 			private:
-				CardData & data_;
+				CardStates & data_;
 			};
 
 			class DamageSetter
@@ -77,30 +77,58 @@ namespace state
 				friend class engine::FlowControl::Manipulators::detail::DamageSetter;
 				friend class engine::FlowControl::Manipulators::CardManipulator;
 			public:
-				DamageSetter(CardData & data) : data_(data) {}
+				DamageSetter(CardStates & data) : data_(data) {}
 			private:
 				void Set(int v) { data_.damaged = v; }
 			private:
-				CardData & data_;
+				CardStates & data_;
 			};
 
 		public:
-			Card() : data_() {}
-			explicit Card(const CardData & data) : data_(data) {}
-			explicit Card(CardData&& data) : data_(std::move(data)) {}
+			Card() : data_(), base_handlers_(nullptr), handlers_(), change_stamp_(0) {}
+			explicit Card(const CardData & data) : data_(data), base_handlers_(nullptr), handlers_(data), change_stamp_(0) {}
+			explicit Card(CardData&& data) : data_(data), base_handlers_(nullptr), handlers_(std::move(data)), change_stamp_(0) {}
+
+			Card(Card const& rhs) :
+				data_(rhs.data_), base_handlers_(rhs.base_handlers_), handlers_(rhs.handlers_),
+				change_stamp_(rhs.change_stamp_)
+			{}
+			Card & operator=(Card const& rhs) {
+				data_ = rhs.data_;
+				base_handlers_ = rhs.base_handlers_;
+				handlers_ = rhs.handlers_;
+				change_stamp_ = rhs.change_stamp_;
+				return *this;
+			}
 
+			// Only the states are copied here; the handlers are borrowed from the base (or from where the
+			// base borrows them, e.g., a prototype in Cards::CardDispatcher), and copied when they are first modified
+			// The change stamp is kept; it is set by the cards manager.
 			void RefCopy(Card const& base) {
-				data_.RefCopy(base.data_);
+				data_ = base.data_;
+				base_handlers_ = &base.GetHandlers();
+			}
+
+			template <typename Writer>
+			void Save(Writer & writer) const {
+				data_.Save(writer);
+				GetHandlers().Save(writer);
+			}
+
+			template <typename Reader>
+			void Load(Reader & reader) {
+				data_.Load(reader);
+				base_handlers_ = nullptr;
+				handlers_.Load(reader);
 			}
 
 			void RestoreToDefault() {
-				auto data = ::Cards::CardDispatcher::CreateInstance(GetCardId());
-				data.enchanted_states.player = data_.enchanted_states.player;
-				data.zone = data_.zone;
-				data.zone_position = data_.zone_position;
+				CardZone const zone = data_.zone;
+				int const zone_position = data_.zone_position;
 
-				data.enchantment_handler.SetOriginalStates(data.enchanted_states);
-				data_ = data;
+				RefCopy(::Cards::CardDispatcher::GetPrototype(GetCardId(), data_.enchanted_states.player));
+				data_.zone = zone;
+				data_.zone_position = zone_position;
 			}
 
 		public: // getters and setters
@@ -182,9 +210,10 @@ namespace state
 			void SetJustPlayedFlag(bool v) { data_.just_played = v; }
 			void SetNumAttacksThisTurn(int v) { data_.num_attacks_this_turn = v; }
 
-			auto const& GetEnchantmentHandler() const { return data_.enchantment_handler; }
-			auto& GetMutableEnchantmentHandler() { return data_.enchantment_handler; }
-			auto& GetMutableDeathrattleHandler() { return data_.deathrattle_handler; }
+			auto const& GetEnchantmentHandler() const { return GetHandlers().enchantment_handler; }
+			auto& GetMutableEnchantmentHandler() { return GetMutableHandlers().enchantment_handler; }
+			auto& GetMutableDeathrattleHandler() { return GetMutableHandlers().deathrattle_handler; }
+			auto const& GetOnPlayHandler() const { return GetHandlers().onplay_handler; }
 
 			ZoneSetter SetZone() { return ZoneSetter(data_); }
 			ZonePosSetter SetZonePos() { return ZonePosSetter(data_); }
@@ -198,11 +227,51 @@ namespace state
 			void SetImmune(bool v) { data_.enchanted_states.immune = v; }
 			bool GetImmune() const { return data_.enchanted_states.immune; }
 
+			// Check the flags which stop a character from attacking
+			// Note: the attack value (considering the weapon) should be checked separately
+			bool IsReadyToAttack() const {
+				if (data_.cant_attack) return false;
+				if (data_.freezed) return false;
+
+				if (data_.card_type == kCardTypeMinion) {
+					if (HasCharge() == false && data_.just_played) return false;
+				}
+
+				if (data_.num_attacks_this_turn >= GetMaxAttacksPerTurn()) return false;
+				return true;
+			}
+
+			CardHandlers const& GetHandlers() const {
+				if (base_handlers_) return *base_handlers_;
+				return handlers_;
+			}
+
 		public:
-			const CardData & GetRawData() const { return data_; }
+			const CardStates & GetRawData() const { return data_; }
+			CardData GetRawDataCopy() const { return CardData(data_, GetHandlers()); }
+
+			// The cards manager's change id when the card was last handed out for modification
+			// (see Cards::Manager::GetChangeId())
+			int GetChangeStamp() const { return change_stamp_; }
+
+		private:
+			CardHandlers & GetMutableHandlers() {
+				if (base_handlers_) {
+					handlers_.RefCopy(*base_handlers_); // copy-on-write
+					base_handlers_ = nullptr;
+				}
+				return handlers_;
+			}
+
+		private:
+			friend class Manager;
+			void SetChangeStamp(int change_stamp) { change_stamp_ = change_stamp; }
 
 		private:
-			CardData data_;
+			CardStates data_;
+			CardHandlers const* base_handlers_;
+			CardHandlers handlers_;
+			int change_stamp_;
 		};
 	}
 }
@@ -15,63 +15,92 @@ namespace state
 {
 	namespace Cards
 	{
-		class CardData
+		// The states read or written in almost every step (zone, damage, attack, etc.)
+		// Kept small and trivially copyable, since it is copied on every copy-on-write of a card
+		class CardStates
 		{
 		public:
-			CardData() :
+			CardStates() :
 				card_id(::Cards::kInvalidCardId),
 				card_type(kCardTypeInvalid), card_race(kCardRaceInvalid), card_rarity(kCardRarityInvalid),
-				is_secret_card(false), overload(0),
+				overload(0),
 				zone(kCardZoneInvalid), zone_position(-1),
-				play_order(-1), damaged(0), just_played(false), num_attacks_this_turn(0), enchanted_states(),
-				pending_destroy(false), used_this_turn(0), usable(true), armor(0),
+				play_order(-1), damaged(0), num_attacks_this_turn(0), enchanted_states(),
+				used_this_turn(0), armor(0),
+				is_secret_card(false), just_played(false), pending_destroy(false), usable(true),
 				taunt(false), shielded(false), cant_attack(false), freezed(false),
-				silenced(false),
-				added_to_play_zone(), added_to_hand_zone(),
-				enchantment_handler(), onplay_handler(), deathrattle_handler()
+				silenced(false)
 			{
 				static_assert(kFieldChangeId == 2);
 			}
 
-			void RefCopy(CardData const& base) {
+			static constexpr int kFieldChangeId = 2;
+
+			// Written field by field, so the encoding does not depend on the padding
+			template <typename Writer>
+			void Save(Writer & writer) const {
 				static_assert(kFieldChangeId == 2);
+				writer.WriteRaw(card_id);
+				writer.WriteRaw(card_type);
+				writer.WriteRaw(card_race);
+				writer.WriteRaw(card_rarity);
+				writer.WriteRaw(overload);
+				writer.WriteRaw(zone);
+				writer.WriteRaw(zone_position);
+				writer.WriteRaw(play_order);
+				writer.WriteRaw(damaged);
+				writer.WriteRaw(num_attacks_this_turn);
+				enchanted_states.Save(writer);
+				writer.WriteRaw(used_this_turn);
+				writer.WriteRaw(armor);
 
-				card_id = base.card_id;
-				card_type = base.card_type;
-				card_race = base.card_race;
-				card_rarity = base.card_rarity;
-				is_secret_card = base.is_secret_card;
-				overload = base.overload;
-				zone = base.zone;
-				zone_position = base.zone_position;
-				play_order = base.play_order;
-				damaged = base.damaged;
-				just_played = base.just_played;
-				num_attacks_this_turn = base.num_attacks_this_turn;
-				enchanted_states = base.enchanted_states;
-				pending_destroy = base.pending_destroy;;
-				used_this_turn = base.used_this_turn;
-				usable = base.usable;
-				armor = base.armor;
-				taunt = base.taunt;
-				shielded = base.shielded;
-				cant_attack = base.cant_attack;
-				freezed = base.freezed;
-				silenced = base.silenced;
-				added_to_play_zone = base.added_to_play_zone;
-				added_to_hand_zone = base.added_to_hand_zone;
-				enchantment_handler.RefCopy(base.enchantment_handler);
-				onplay_handler = base.onplay_handler;
-				deathrattle_handler.RefCopy(base.deathrattle_handler);
+				uint16_t flags = 0;
+				if (is_secret_card) flags |= 1 << 0;
+				if (just_played) flags |= 1 << 1;
+				if (pending_destroy) flags |= 1 << 2;
+				if (usable) flags |= 1 << 3;
+				if (taunt) flags |= 1 << 4;
+				if (shielded) flags |= 1 << 5;
+				if (cant_attack) flags |= 1 << 6;
+				if (freezed) flags |= 1 << 7;
+				if (silenced) flags |= 1 << 8;
+				writer.WriteRaw(flags);
 			}
 
-			static constexpr int kFieldChangeId = 2;
+			template <typename Reader>
+			void Load(Reader & reader) {
+				static_assert(kFieldChangeId == 2);
+				reader.ReadRaw(card_id);
+				reader.ReadRaw(card_type);
+				reader.ReadRaw(card_race);
+				reader.ReadRaw(card_rarity);
+				reader.ReadRaw(overload);
+				reader.ReadRaw(zone);
+				reader.ReadRaw(zone_position);
+				reader.ReadRaw(play_order);
+				reader.ReadRaw(damaged);
+				reader.ReadRaw(num_attacks_this_turn);
+				enchanted_states.Load(reader);
+				reader.ReadRaw(used_this_turn);
+				reader.ReadRaw(armor);
+
+				uint16_t flags;
+				reader.ReadRaw(flags);
+				is_secret_card = (flags & (1 << 0)) != 0;
+				just_played = (flags & (1 << 1)) != 0;
+				pending_destroy = (flags & (1 << 2)) != 0;
+				usable = (flags & (1 << 3)) != 0;
+				taunt = (flags & (1 << 4)) != 0;
+				shielded = (flags & (1 << 5)) != 0;
+				cant_attack = (flags & (1 << 6)) != 0;
+				freezed = (flags & (1 << 7)) != 0;
+				silenced = (flags & (1 << 8)) != 0;
+			}
 
 			::Cards::CardId card_id;
 			CardType card_type;
 			CardRace card_race;
 			CardRarity card_rarity;
-			bool is_secret_card;
 			int overload; // 0: no overload; 1: overload 1 crystal; etc.
 
 			CardZone zone;
@@ -79,26 +108,74 @@ namespace state
 
 			int play_order;
 			int damaged;
-			bool just_played;
 			int num_attacks_this_turn;
 			EnchantableStates enchanted_states;
 
-			bool pending_destroy;
-
 			int used_this_turn; // for hero power
-			bool usable; // for hero power
 
 			int armor; // for hero
 
+		public: // flags
+			bool is_secret_card : 1;
+			bool just_played : 1;
+			bool pending_destroy : 1;
+			bool usable : 1; // for hero power
+
 		public: // for minions
-			bool taunt;
-			bool shielded;
-			bool cant_attack;
-			bool freezed;
+			bool taunt : 1;
+			bool shielded : 1;
+			bool cant_attack : 1;
+			bool freezed : 1;
+
+			bool silenced : 1;
+		};
+
+		// The handlers and callbacks of a card, which are touched only occasionally
+		class CardHandlers
+		{
+		public:
+			CardHandlers() :
+				added_to_play_zone(), added_to_hand_zone(),
+				enchantment_handler(), onplay_handler(), deathrattle_handler()
+			{
+				static_assert(kFieldChangeId == 2);
+			}
+
+			void RefCopy(CardHandlers const& base) {
+				static_assert(kFieldChangeId == 2);
+
+				added_to_play_zone = base.added_to_play_zone;
+				added_to_hand_zone = base.added_to_hand_zone;
+				enchantment_handler.RefCopy(base.enchantment_handler);
+				onplay_handler = base.onplay_handler;
+				deathrattle_handler.RefCopy(base.deathrattle_handler);
+			}
+
+			template <typename Writer>
+			void Save(Writer & writer) const {
+				static_assert(kFieldChangeId == 2);
 
-			bool silenced;
+				added_to_play_zone.Save(writer);
+				added_to_hand_zone.Save(writer);
+				enchantment_handler.Save(writer);
+				onplay_handler.Save(writer);
+				deathrattle_handler.Save(writer);
+			}
+
+			template <typename Reader>
+			void Load(Reader & reader) {
+				static_assert(kFieldChangeId == 2);
+
+				added_to_play_zone.Load(reader);
+				added_to_hand_zone.Load(reader);
+				enchantment_handler.Load(reader);
+				onplay_handler.Load(reader);
+				deathrattle_handler.Load(reader);
+			}
+
+			static constexpr int kFieldChangeId = 2;
 
-		public: // zone-changed callbacks invoked by state::State 
+		public: // zone-changed callbacks invoked by state::State
 			Utils::FuncPtrArray<AddedToPlayZoneCallback*, 1> added_to_play_zone;
 			Utils::FuncPtrArray<AddedToHandZoneCallback*, 1> added_to_hand_zone;
 
@@ -107,5 +184,17 @@ namespace state
 			engine::FlowControl::onplay::Handler onplay_handler;
 			engine::FlowControl::deathrattle::Handler deathrattle_handler;
 		};
+
+		// All the data of a card; used to define and to create a card
+		// A card in a state stores the two parts separately (see state::Cards::Card)
+		class CardData : public CardStates, public CardHandlers
+		{
+		public:
+			CardData() : CardStates(), CardHandlers() {}
+
+			CardData(CardStates const& states, CardHandlers const& handlers) :
+				CardStates(states), CardHandlers(handlers)
+			{}
+		};
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <array>
+#include "state/Types.h"
+#include "state/Cards/Card.h"
+
+namespace state
+{
+	namespace Cards
+	{
+		// A Zobrist-style hash of the visible cards: the XOR of one key for each card
+		// The keys are computed for each viewer, since the viewer cannot see the opponent's hand cards.
+		// Only the states in engine::view::ReducedBoardView are hashed.
+		//
+		// A card is marked dirty before it is modified (see Cards::Manager::GetMutable), and its old key
+		// is removed right away. The new keys of the dirty cards are added back lazily in Get().
+		class CardsHash
+		{
+		public:
+			static constexpr size_t kMaxTrackedCards = 256;
+
+			CardsHash() : hashes_(), dirty_(), has_dirty_(false), overflowed_(false) {}
+
+			// Called before a card is modified
+			void BeforeModify(int idx, Card const& card) {
+				if (idx >= (int)kMaxTrackedCards) {
+					overflowed_ = true;
+					return;
+				}
+
+				uint64_t mask = (uint64_t)1 << (idx % 64);
+				uint64_t & dirty_word = dirty_[idx / 64];
+				if (dirty_word & mask) return;
+
+				dirty_word |= mask;
+				has_dirty_ = true;
+				hashes_[0] ^= GetKey(card, kPlayerFirst);
+				hashes_[1] ^= GetKey(card, kPlayerSecond);
+			}
+
+			// Called before a card is dropped (see Cards::Manager::Truncate)
+			void Remove(int idx, Card const& card) {
+				if (idx >= (int)kMaxTrackedCards) return;
+
+				uint64_t mask = (uint64_t)1 << (idx % 64);
+				uint64_t & dirty_word = dirty_[idx / 64];
+				if (dirty_word & mask) {
+					dirty_word &= ~mask; // the old key is already removed
+					return;
+				}
+
+				hashes_[0] ^= GetKey(card, kPlayerFirst);
+				hashes_[1] ^= GetKey(card, kPlayerSecond);
+			}
+
+			// Mark all the cards dirty, so the hash is rebuilt in Get()
+			void Reset(size_t cards_count) {
+				hashes_.fill(0);
+				dirty_.fill(0);
+				has_dirty_ = false;
+				overflowed_ = (cards_count > kMaxTrackedCards);
+				if (overflowed_) return;
+
+				for (size_t idx = 0; idx < cards_count; ++idx) {
+					dirty_[idx / 64] |= (uint64_t)1 << (idx % 64);
+					has_dirty_ = true;
+				}
+			}
+
+			// CardGetter: Card const& (int idx)
+			// Note: The pending keys are folded into the hash here, so two threads should not query
+			//       the same instance at the same time.
+			template <typename CardGetter>
+			uint64_t Get(PlayerSide viewer, size_t cards_count, CardGetter && card_getter) const {
+				assert(viewer == kPlayerFirst || viewer == kPlayerSecond);
+				if (overflowed_) {
+					return Compute(viewer, cards_count, card_getter);
+				}
+
+				if (has_dirty_) {
+					for (size_t word = 0; word < dirty_.size(); ++word) {
+						for (size_t bit = 0; dirty_[word] != 0; ++bit, dirty_[word] >>= 1) {
+							if (!(dirty_[word] & 1)) continue;
+
+							Card const& card = card_getter((int)(word * 64 + bit));
+							hashes_[0] ^= GetKey(card, kPlayerFirst);
+							hashes_[1] ^= GetKey(card, kPlayerSecond);
+						}
+					}
+					has_dirty_ = false;
+				}
+				return hashes_[viewer == kPlayerFirst ? 0 : 1];
+			}
+
+			// Full recompute
+			template <typename CardGetter>
+			static uint64_t Compute(PlayerSide viewer, size_t cards_count, CardGetter && card_getter) {
+				uint64_t result = 0;
+				for (size_t idx = 0; idx < cards_count; ++idx) {
+					result ^= GetKey(card_getter((int)idx), viewer);
+				}
+				return result;
+			}
+
+			static uint64_t Mix(uint64_t seed, uint64_t v) {
+				seed ^= v + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+				return seed;
+			}
+
+			static uint64_t Finalize(uint64_t v) {
+				v = (v ^ (v >> 30)) * 0xbf58476d1ce4e5b9ULL;
+				v = (v ^ (v >> 27)) * 0x94d049bb133111ebULL;
+				return v ^ (v >> 31);
+			}
+
+		private:
+			static uint64_t GetKey(Card const& card, PlayerSide viewer) {
+				PlayerSide owner = card.GetPlayerIdentifier().GetSide();
+
+				uint64_t key = Mix(card.GetZone(), owner);
+				switch (card.GetZone()) {
+				case kCardZonePlay:
+					key = Mix(key, card.GetCardType());
+					key = Mix(key, card.GetCardId());
+					switch (card.GetCardType()) {
+					case kCardTypeHero:
+						key = Mix(key, card.GetAttack());
+						key = Mix(key, card.GetHP());
+						key = Mix(key, card.GetMaxHP());
+						key = Mix(key, card.GetArmor());
+						if (owner == viewer) key = MixAttackStates(key, card);
+						break;
+					case kCardTypeMinion:
+						key = Mix(key, card.GetZonePosition());
+						key = Mix(key, card.GetAttack());
+						key = Mix(key, card.GetHP());
+						key = Mix(key, card.GetMaxHP());
+						key = Mix(key, card.IsSilenced());
+						if (owner == viewer) key = MixAttackStates(key, card);
+						break;
+					case kCardTypeWeapon:
+						key = Mix(key, card.GetAttack());
+						key = Mix(key, card.GetHP());
+						break;
+					case kCardTypeHeroPower:
+						key = Mix(key, card.GetRawData().usable);
+						break;
+					default:
+						return 0; // secrets are not part of the board view
+					}
+					break;
+
+				case kCardZoneHand:
+					key = Mix(key, card.GetZonePosition());
+					if (owner == viewer) {
+						key = Mix(key, card.GetCardId());
+						key = Mix(key, card.GetCost());
+						key = Mix(key, card.GetAttack());
+						key = Mix(key, card.GetHP());
+					}
+					break;
+
+				default:
+					return 0;
+				}
+				return Finalize(key);
+			}
+
+			// The states used to decide if a character is attackable
+			static uint64_t MixAttackStates(uint64_t key, Card const& card) {
+				auto const& data = card.GetRawData();
+				key = Mix(key, data.num_attacks_this_turn);
+				key = Mix(key, data.just_played);
+				key = Mix(key, data.freezed);
+				key = Mix(key, data.cant_attack);
+				return key;
+			}
+
+		private:
+			mutable std::array<uint64_t, 2> hashes_;
+			mutable std::array<uint64_t, kMaxTrackedCards / 64> dirty_;
+			mutable bool has_dirty_;
+			bool overflowed_;
+		};
+	}
+}
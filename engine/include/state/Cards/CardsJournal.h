@@ -0,0 +1,77 @@
+#pragma once
+
+#include <assert.h>
+#include <vector>
+#include "Utils/NeverShrinkVector.h"
+#include "state/Cards/Card.h"
+
+namespace state
+{
+	namespace Cards
+	{
+		// Records the before-image of each card modified in a frame (see state::UndoJournal)
+		// A card is recorded at most once per frame; the cards created in a frame are not recorded,
+		//    since they are simply dropped on undo.
+		// The records are kept in a buffer which is reused, so no allocation is needed once warmed up.
+		class CardsJournal
+		{
+		public:
+			CardsJournal() :
+				records_(), records_count_(0), recorded_serials_(), serial_(0), frame_cards_count_(0)
+			{}
+
+			void BeginFrame(size_t cards_count) {
+				++serial_;
+				frame_cards_count_ = cards_count;
+			}
+
+			size_t GetRecordsCount() const { return records_count_; }
+
+			void Clear() { records_count_ = 0; }
+
+			// Called by Cards::Manager before a card is modified
+			void BeforeModify(int idx, Utils::PersistentOptionalItem<Card> const& item) {
+				if ((size_t)idx >= frame_cards_count_) return;
+
+				if ((size_t)idx >= recorded_serials_.size()) recorded_serials_.resize(frame_cards_count_, 0);
+				if (recorded_serials_[idx] == serial_) return;
+				recorded_serials_[idx] = serial_;
+
+				if (records_count_ == records_.size()) records_.emplace_back();
+				Record & record = records_[records_count_];
+				++records_count_;
+
+				record.idx = idx;
+				record.was_set = item.HasSet();
+				if (record.was_set) record.card = item.Get();
+			}
+
+			// Functor: void(int idx, bool was_set, Card const& card)
+			// The records after 'records_begin' are popped in reverse order
+			template <typename Functor>
+			void PopRecords(size_t records_begin, Functor&& functor) {
+				assert(records_begin <= records_count_);
+				while (records_count_ > records_begin) {
+					--records_count_;
+					Record const& record = records_[records_count_];
+					functor(record.idx, record.was_set, record.card);
+				}
+			}
+
+		private:
+			struct Record {
+				Record() : idx(-1), was_set(false), card() {}
+
+				int idx;
+				bool was_set; // false if the card was still borrowed from the base (see Cards::Manager::RefCopy)
+				Card card;
+			};
+
+			std::vector<Record> records_;
+			size_t records_count_;
+			std::vector<int> recorded_serials_; // the serial of the frame in which a card was recorded
+			int serial_;
+			size_t frame_cards_count_;
+		};
+	}
+}
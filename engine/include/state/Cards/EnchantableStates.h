@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stdint.h>
 #include "state/Types.h"
 
 namespace state
@@ -52,6 +53,48 @@ namespace state
 				spell_damage = 0;
 			}
 
+			template <typename Writer>
+			void Save(Writer & writer) const {
+				static_assert(kFieldChangeId == 17, "field changed");
+				writer.WriteRaw(player);
+				writer.WriteRaw(cost);
+				writer.WriteRaw(attack);
+				writer.WriteRaw(max_hp);
+				writer.WriteRaw(max_attacks_per_turn);
+				writer.WriteRaw(spell_damage);
+
+				uint8_t flags = 0;
+				if (charge) flags |= 1 << 0;
+				if (stealth) flags |= 1 << 1;
+				if (immune_to_spell) flags |= 1 << 2;
+				if (poisonous) flags |= 1 << 3;
+				if (freeze_attack) flags |= 1 << 4;
+				if (cant_attack_hero) flags |= 1 << 5;
+				if (immune) flags |= 1 << 6;
+				writer.WriteRaw(flags);
+			}
+
+			template <typename Reader>
+			void Load(Reader & reader) {
+				static_assert(kFieldChangeId == 17, "field changed");
+				reader.ReadRaw(player);
+				reader.ReadRaw(cost);
+				reader.ReadRaw(attack);
+				reader.ReadRaw(max_hp);
+				reader.ReadRaw(max_attacks_per_turn);
+				reader.ReadRaw(spell_damage);
+
+				uint8_t flags;
+				reader.ReadRaw(flags);
+				charge = (flags & (1 << 0)) != 0;
+				stealth = (flags & (1 << 1)) != 0;
+				immune_to_spell = (flags & (1 << 2)) != 0;
+				poisonous = (flags & (1 << 3)) != 0;
+				freeze_attack = (flags & (1 << 4)) != 0;
+				cant_attack_hero = (flags & (1 << 5)) != 0;
+				immune = (flags & (1 << 6)) != 0;
+			}
+
 		public:
 			static constexpr int kFieldChangeId = 17; // Change this if any field is changed. This helps to see where you should also modify
 
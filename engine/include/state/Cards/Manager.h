@@ -6,6 +6,8 @@
 #include "Utils/CloneableContainers/Vector.h"
 #include "Utils/NeverShrinkVector.h"
 #include "state/Cards/Card.h"
+#include "state/Cards/CardsHash.h"
+#include "state/Cards/CardsJournal.h"
 #include "state/Types.h"
 
 namespace state
@@ -20,10 +22,12 @@ namespace state
 			// A customized vector is used to ensure the underlying buffer only grows, never shrinks
 			typedef Utils::CloneableContainers::Vector<ItemType, Utils::NeverShrinkVector<ItemType>> ContainerType;
 
-			Manager() : base_(nullptr), cards_() {}
+			Manager() : base_(nullptr), cards_(), hash_(), change_id_(0), journal_(nullptr) {}
 
+			// The journal is not copied; it is attached to one instance only
 			Manager(Manager const& rhs) :
-				base_(rhs.base_), cards_(rhs.cards_)
+				base_(rhs.base_), cards_(rhs.cards_), hash_(rhs.hash_), change_id_(rhs.change_id_),
+				journal_(nullptr)
 			{}
 
 			void RefCopy(Manager const& base) {
@@ -32,11 +36,16 @@ namespace state
 
 				cards_.Reset();
 				cards_.Resize(base.cards_.Size());
+
+				hash_ = base.hash_;
+				change_id_ = base.change_id_;
 			}
 
 			Manager & operator=(Manager const& rhs) {
 				base_ = rhs.base_;
 				cards_ = rhs.cards_;
+				hash_ = rhs.hash_;
+				change_id_ = rhs.change_id_;
 				return *this;
 			}
 
@@ -50,29 +59,124 @@ namespace state
 			}
 
 			Card & GetMutable(CardRef id) {
+				++change_id_;
+
 				auto & item = cards_.Get(id.id);
-				if (item.HasSet()) return item.Get();
+				if (journal_) journal_->BeforeModify(id.id, item);
+
+				if (item.HasSet()) {
+					hash_.BeforeModify(id.id, item.Get());
+					item.Get().SetChangeStamp(change_id_);
+					return item.Get();
+				}
 
 				assert(base_);
 				assert(id.id < (int)base_->cards_.Size());
-				item.RefCopy(base_->Get(id)); // copy-on-write
+				Card const& base_card = base_->Get(id);
+				hash_.BeforeModify(id.id, base_card);
+				item.RefCopy(base_card); // copy-on-write
+				item.Get().SetChangeStamp(change_id_);
 				return item.Get();
 			}
 
 			CardRef PushBack(Cards::Card && card)
 			{
 				assert(card.GetZone() == kCardZoneNewlyCreated);
+				++change_id_;
+				card.SetChangeStamp(change_id_);
 				return CardRef(cards_.PushBack(std::move(card)));
 			}
 
+			// Increased whenever a card might be modified; never decreases
+			// A card modified after the change id was 'id' has Card::GetChangeStamp() > id.
+			int GetChangeId() const { return change_id_; }
+
+			size_t GetCount() const { return cards_.Size(); }
+
+			// Functor: bool(CardRef ref, Card const& card), return true to continue; false to abort
+			template <typename Functor>
+			void ForEach(Functor&& functor) const {
+				for (size_t idx = 0; idx < cards_.Size(); ++idx) {
+					CardRef ref(cards_.GetIdentifier(idx));
+					if (!functor(ref, Get(ref))) return;
+				}
+			}
+
+		public: // undo (see state::UndoJournal)
+			void SetJournal(CardsJournal * journal) { journal_ = journal; }
+
+			void Restore(int idx, bool was_set, Card const& card) {
+				++change_id_;
+				auto & item = cards_.Get(cards_.GetIdentifier(idx));
+				hash_.BeforeModify(idx, Get(CardRef(cards_.GetIdentifier(idx))));
+				if (was_set) {
+					item.Set(card);
+					item.Get().SetChangeStamp(change_id_);
+				}
+				else item.UnSet(); // the base card may have an older stamp; caches are invalidated after an undo
+			}
+
+			// Drop the cards created after the first 'count' cards
+			void Truncate(size_t count) {
+				++change_id_;
+				for (size_t idx = count; idx < cards_.Size(); ++idx) {
+					hash_.Remove((int)idx, Get(CardRef(cards_.GetIdentifier(idx))));
+				}
+				cards_.Resize(count);
+			}
+
+		public: // archive
+			// The borrowed cards are written as well; the hash is rebuilt after loaded
+			template <typename Writer>
+			void Save(Writer & writer) const {
+				writer.WriteSize(cards_.Size());
+				ForEach([&](CardRef, Card const& card) {
+					card.Save(writer);
+					return true;
+				});
+			}
+
+			template <typename Reader>
+			void Load(Reader & reader) {
+				base_ = nullptr;
+				cards_.Reset();
+				size_t count = reader.ReadSize();
+				for (size_t idx = 0; idx < count; ++idx) {
+					auto id = cards_.PushBack(Card());
+					cards_.Get(id).Get().Load(reader); // loaded in place, so the buffers of a reused state are reused
+				}
+				hash_.Reset(count);
+				++change_id_;
+			}
+
+		public:
 			void SetCardZonePos(CardRef ref, int pos)
 			{
 				GetMutable(ref).SetZonePos()(pos);
 			}
 
+			// Hash of the cards seen by 'viewer'; see CardsHash
+			uint64_t GetHash(PlayerSide viewer) const {
+				uint64_t hash = hash_.Get(viewer, cards_.Size(), [this](int idx) -> Card const& {
+					return Get(CardRef(cards_.GetIdentifier(idx)));
+				});
+				assert(hash == ComputeHash(viewer));
+				return hash;
+			}
+
+			// Full recompute; used to cross-check the incremental hash in debug builds
+			uint64_t ComputeHash(PlayerSide viewer) const {
+				return CardsHash::Compute(viewer, cards_.Size(), [this](int idx) -> Card const& {
+					return Get(CardRef(cards_.GetIdentifier(idx)));
+				});
+			}
+
 		private:
 			Manager const* base_;
 			ContainerType cards_;
+			CardsHash hash_;
+			int change_id_;
+			CardsJournal * journal_;
 		};
 	}
 }
\ No newline at end of file
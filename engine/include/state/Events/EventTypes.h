@@ -1,8 +1,8 @@
 
 #include <tuple>
 #include <string>
-#include <functional>
 #include "state/Types.h"
+#include "Utils/TrivialFunction.h"
 
 namespace engine {
 	namespace FlowControl { class Manipulate; }
@@ -20,21 +20,21 @@ namespace state {
 					int * cost_;
 					bool * cost_health_instead_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 			struct AfterMinionPlayed {
 				struct Context {
 					engine::FlowControl::Manipulate const& manipulate_;
 					CardRef card_ref_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 			struct AfterMinionSummoned {
 				struct Context {
 					engine::FlowControl::Manipulate const& manipulate_;
 					CardRef card_ref_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 			struct AfterMinionDied {
 				struct Context {
@@ -42,7 +42,7 @@ namespace state {
 					CardRef card_ref_;
 					state::PlayerIdentifier died_minion_owner_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 			struct BeforeMinionSummoned {
 				struct Context {
@@ -58,7 +58,7 @@ namespace state {
 					state::CardRef attacker_;
 					state::CardRef * defender_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 			struct BeforeAttack {
 				struct Context {
@@ -66,7 +66,7 @@ namespace state {
 					state::CardRef attacker_;
 					state::CardRef defender_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 			struct AfterAttack {
 				struct Context {
@@ -74,7 +74,7 @@ namespace state {
 					state::CardRef attacker_;
 					state::CardRef defender_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 			
 			struct PreparePlayCardTarget {
@@ -83,14 +83,14 @@ namespace state {
 					state::CardRef card_ref_;
 					state::CardRef * target_ref_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 			struct OnPlay {
 				struct Context {
 					engine::FlowControl::Manipulate const& manipulate_;
 					state::CardRef card_ref_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 			struct CheckPlayCardCountered {
 				struct Context {
@@ -98,7 +98,7 @@ namespace state {
 					state::CardRef card_ref_;
 					bool * countered_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 
 			struct CalculateHealDamageAmount {
@@ -107,7 +107,7 @@ namespace state {
 					state::CardRef const source_ref_;
 					int * amount_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 			struct PrepareHealDamageTarget {
 				struct Context {
@@ -115,7 +115,7 @@ namespace state {
 					state::CardRef const source_ref_;
 					state::CardRef * target_ref_; // an invalid target means the damage event is cancelled
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 
 			struct OnTakeDamage {
@@ -124,7 +124,7 @@ namespace state {
 					state::CardRef card_ref_;
 					int * damage_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 			struct CategorizedOnTakeDamage {
 				struct Context {
@@ -140,7 +140,7 @@ namespace state {
 					int damage_;
 					int damage_after_armor_absorbed_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 
 			struct AfterHeroPower { // a.k.a. inspire
@@ -157,7 +157,7 @@ namespace state {
 					state::PlayerIdentifier player_;
 					state::CardRef const card_ref_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 
 			struct AfterSecretPlayed {
@@ -166,7 +166,7 @@ namespace state {
 					state::PlayerIdentifier player_;
 					state::CardRef const card_ref_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 
 			struct OnHeal {
@@ -175,19 +175,19 @@ namespace state {
 					state::CardRef card_ref_;
 					int amount_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 			struct OnTurnEnd {
 				struct Context {
 					engine::FlowControl::Manipulate const& manipulate_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 			struct OnTurnStart {
 				struct Context {
 					engine::FlowControl::Manipulate const& manipulate_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 
 			struct BeforeSecretReveal {
@@ -195,7 +195,7 @@ namespace state {
 					engine::FlowControl::Manipulate const& manipulate_;
 					state::CardRef card_ref_;
 				};
-				using type = std::function<bool(Context const&)>;
+				using type = Utils::TrivialFunction<bool(Context const&)>;
 			};
 		}
 	}
@@ -42,21 +42,49 @@ namespace state
 			};
 
 		public:
-			Manager() : event_trigger_recursive_count_(0), event_tuple_(), categorized_event_tuple_() {}
+			Manager() : event_trigger_recursive_count_(0), change_id_(0), event_tuple_(), categorized_event_tuple_() {}
 
 			void RefCopy(Manager const& base) {
 				event_trigger_recursive_count_ = base.event_trigger_recursive_count_;
+				change_id_ = base.change_id_;
 				CopyOnWriteHelper::CopyOnWrite(this->event_tuple_, base.event_tuple_);
 				CopyOnWriteHelper::CopyOnWrite(this->categorized_event_tuple_, base.categorized_event_tuple_);
 			}
 
+			// Erase the handlers removed since the last compaction
+			void Compact() {
+				++change_id_;
+				std::apply([](auto&... containers) { (containers.Compact(), ...); }, event_tuple_);
+			}
+
+			template <typename Writer>
+			void Save(Writer & writer) const {
+				writer.WriteRaw(event_trigger_recursive_count_);
+				std::apply([&](auto const&... containers) { (containers.Save(writer), ...); }, event_tuple_);
+				std::apply([&](auto const&... containers) { (containers.Save(writer), ...); }, categorized_event_tuple_);
+			}
+
+			template <typename Reader>
+			void Load(Reader & reader) {
+				++change_id_;
+				reader.ReadRaw(event_trigger_recursive_count_);
+				std::apply([&](auto&... containers) { (containers.Load(reader), ...); }, event_tuple_);
+				std::apply([&](auto&... containers) { (containers.Load(reader), ...); }, categorized_event_tuple_);
+			}
+
+			// Increased whenever a handler might be added or removed
+			// Note: an undo restores an older change id; the caches keyed on it are invalidated then.
+			int GetChangeId() const { return change_id_; }
+
 			template <typename EventType, typename T>
 			void PushBack(T&& handler) {
+				++change_id_;
 				GetHandlersContainer<EventType>().PushBack(std::forward<T>(handler));
 			}
 
 			template <typename EventType, typename T>
 			void PushBack(CardRef card_ref, T&& handler) {
+				++change_id_;
 				GetCategorizedHandlersContainer<EventType>().PushBack(
 					card_ref, std::forward<T>(handler));
 			}
@@ -65,6 +93,7 @@ namespace state
 			void TriggerEvent(Args&&... args)
 			{
 				if (event_trigger_recursive_count_ >= max_event_trigger_recursive_) return;
+				++change_id_; // a handler returning false is removed
 				++event_trigger_recursive_count_;
 				GetHandlersContainer<EventTriggerType>().TriggerAll(std::forward<Args>(args)...);
 				--event_trigger_recursive_count_;
@@ -74,6 +103,7 @@ namespace state
 			void TriggerCategorizedEvent(CardRef card_ref, Args&&... args)
 			{
 				if (event_trigger_recursive_count_ >= max_event_trigger_recursive_) return;
+				++change_id_; // a handler returning false is removed
 				++event_trigger_recursive_count_;
 				GetCategorizedHandlersContainer<EventTriggerType>()
 					.TriggerAll(card_ref, std::forward<Args>(args)...);
@@ -102,6 +132,7 @@ namespace state
 		private:
 			constexpr static int max_event_trigger_recursive_ = 100;
 			mutable int event_trigger_recursive_count_; // obey logical const meanings
+			int change_id_;
 
 		private:
 			using EvnetTypesTuple = std::tuple<
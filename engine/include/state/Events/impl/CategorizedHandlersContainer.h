@@ -2,6 +2,7 @@
 
 #include <utility>
 #include <unordered_map>
+#include "Utils/CodeRegistry.h"
 #include "state/Events/impl/HandlersContainer.h"
 #include "state/Types.h"
 
@@ -16,9 +17,13 @@ namespace state
 			{
 			private:
 				struct Item {
+					Item() : card_ref(), handler() {}
+					Item(state::CardRef card_ref, typename TriggerType::type handler) : card_ref(card_ref), handler(handler) {}
+
 					state::CardRef card_ref;
 					typename TriggerType::type handler;
 				};
+				static_assert(std::is_trivially_copyable_v<Item>);
 
 			public:
 				CategorizedHandlersContainer() : base_(nullptr), handlers_() {}
@@ -48,7 +53,7 @@ namespace state
 				{
 					static_assert(std::is_convertible_v<std::decay_t<HandlerType_>, typename TriggerType::type>, "Wrong type");
 					GetContainerForWrite().push_back(
-						Item{ card_ref, std::forward<HandlerType_>(handler) });
+						Item(card_ref, Utils::CodeRegistry::Make<typename TriggerType::type>(std::forward<HandlerType_>(handler))));
 				}
 
 				template <typename... Args>
@@ -112,6 +117,26 @@ namespace state
 					}
 				}
 
+				template <typename Writer>
+				void Save(Writer & writer) const {
+					auto const& items = base_ ? *base_ : handlers_;
+					writer.WriteSize(items.size());
+					for (auto const& item : items) {
+						writer.WriteRaw(item.card_ref);
+						writer.Write(item.handler);
+					}
+				}
+
+				template <typename Reader>
+				void Load(Reader & reader) {
+					base_ = nullptr;
+					handlers_.resize(reader.ReadSize());
+					for (auto & item : handlers_) {
+						reader.ReadRaw(item.card_ref);
+						reader.Read(item.handler);
+					}
+				}
+
 			private:
 				using container_type = std::vector<Item>;
 
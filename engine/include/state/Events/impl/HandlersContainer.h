@@ -1,34 +1,54 @@
 #pragma once
 
+#include <assert.h>
+#include <stdint.h>
+#include <algorithm>
 #include <vector>
 #include <type_traits>
 #include <utility>
 
+#include "Utils/CodeRegistry.h"
+
 namespace state
 {
 	namespace Events
 	{
 		namespace impl {
+			// Removed handlers are left as tombstones (a null handler), and are erased by Compact()
+			//    Compact() is called once an action is fully performed, so the handlers never shift
+			//    during a (possibly nested) event resolve.
+			// While the handlers are still borrowed from a base (see RefCopy()), the first tombstones
+			//    are recorded in a bit mask, so the copy-on-write is deferred to the first push-back
+			//    or to the compaction.
 			template <typename TriggerType>
 			class HandlersContainer
 			{
+				// Handlers are copied on every copy-on-write, which is then a plain memory copy
+				static_assert(std::is_trivially_copyable_v<typename TriggerType::type>);
+
 			public:
-				HandlersContainer() : base_(nullptr), handlers_() {}
+				HandlersContainer() : base_(nullptr), handlers_(), borrowed_tombstones_(0), tombstones_(0) {}
 
 				HandlersContainer(HandlersContainer const& rhs) :
 					base_(rhs.base_),
-					handlers_(rhs.handlers_)
+					handlers_(rhs.handlers_),
+					borrowed_tombstones_(rhs.borrowed_tombstones_),
+					tombstones_(rhs.tombstones_)
 				{}
 
 				HandlersContainer & operator=(HandlersContainer const& rhs) {
 					base_ = rhs.base_;
 					handlers_ = rhs.handlers_;
+					borrowed_tombstones_ = rhs.borrowed_tombstones_;
+					tombstones_ = rhs.tombstones_;
 					return *this;
 				}
 
 				void RefCopy(HandlersContainer<TriggerType> const& base) {
 					assert(base.base_ == nullptr);
 					base_ = &base.handlers_;
+					borrowed_tombstones_ = 0;
+					tombstones_ = 0;
 				}
 
 				// Cloneable by copy semantics
@@ -39,7 +59,8 @@ namespace state
 				void PushBack(T&& handler)
 				{
 					static_assert(std::is_convertible_v<std::decay_t<T>, typename TriggerType::type>, "Wrong type");
-					GetContainerForWrite().push_back(std::forward<T>(handler));
+					GetContainerForWrite().push_back(
+						Utils::CodeRegistry::Make<typename TriggerType::type>(std::forward<T>(handler)));
 				}
 
 				// Note: Do not provide remove interface to outside
@@ -60,18 +81,15 @@ namespace state
 					if (GetContainerForRead().empty()) return;
 
 					size_t origin_size = GetContainerForRead().size();
-					for (size_t idx = 0; idx < GetContainerForRead().size();) {
-						if (idx >= origin_size) break; // do not trigger newly-added handlers
+					for (size_t idx = 0; idx < origin_size; ++idx) { // do not trigger newly-added handlers
+						if (IsBorrowedTombstone(idx)) continue;
+						auto const& handler = GetContainerForRead()[idx];
+						if (!handler) continue;
 
-						auto ret = GetContainerForRead()[idx](std::forward<Args>(args)...);
+						auto ret = handler(std::forward<Args>(args)...);
 						static_assert(std::is_same_v<decltype(ret), bool>, "Should return a boolean flag indicating if we should remove the item.");
 
-						if (!ret) {
-							GetContainerForWrite().erase(GetContainerForWrite().begin() + idx);
-						}
-						else {
-							++idx;
-						}
+						if (!ret) MarkRemoved(idx);
 					}
 				}
 
@@ -89,15 +107,69 @@ namespace state
 					if (GetContainerForRead().empty()) return;
 
 					size_t origin_size = GetContainerForRead().size();
-					for (size_t idx = 0; idx < GetContainerForRead().size();++idx) {
-						if (idx >= origin_size) break; // do not trigger newly-added handlers
+					for (size_t idx = 0; idx < origin_size; ++idx) { // do not trigger newly-added handlers
+						if (IsBorrowedTombstone(idx)) continue;
+						auto const& handler = GetContainerForRead()[idx];
+						if (!handler) continue;
+
+						handler(std::forward<Args>(args)...);
+					}
+				}
+
+				// Erase the tombstones. Should not be called during an event resolve.
+				void Compact() {
+					if (tombstones_ == 0) return;
+
+					GetContainerForWrite(); // copy the borrowed handlers, with the tombstones applied
+					handlers_.erase(
+						std::remove_if(handlers_.begin(), handlers_.end(),
+							[](typename TriggerType::type const& handler) { return !handler; }),
+						handlers_.end());
+					tombstones_ = 0;
+				}
 
-						GetContainerForRead()[idx](std::forward<Args>(args)...);
+				// The borrowed tombstones are written as null handlers
+				template <typename Writer>
+				void Save(Writer & writer) const {
+					auto const& handlers = GetContainerForRead();
+					writer.WriteSize(handlers.size());
+					for (size_t idx = 0; idx < handlers.size(); ++idx) {
+						if (IsBorrowedTombstone(idx)) writer.Write(typename TriggerType::type());
+						else writer.Write(handlers[idx]);
 					}
+					writer.WriteRaw(tombstones_);
+				}
+
+				template <typename Reader>
+				void Load(Reader & reader) {
+					base_ = nullptr;
+					borrowed_tombstones_ = 0;
+					handlers_.resize(reader.ReadSize());
+					for (auto & handler : handlers_) reader.Read(handler);
+					reader.ReadRaw(tombstones_);
 				}
 
 			private:
 				typedef std::vector<typename TriggerType::type> container_type;
+				static constexpr size_t kMaxBorrowedTombstones = 64;
+
+				bool IsBorrowedTombstone(size_t idx) const {
+					if (!base_) return false;
+					if (idx >= kMaxBorrowedTombstones) return false;
+					return (borrowed_tombstones_ & ((uint64_t)1 << idx)) != 0;
+				}
+
+				void MarkRemoved(size_t idx) {
+					assert(!IsBorrowedTombstone(idx));
+					assert(GetContainerForRead()[idx]);
+					++tombstones_;
+
+					if (base_ && idx < kMaxBorrowedTombstones) {
+						borrowed_tombstones_ |= ((uint64_t)1 << idx);
+						return;
+					}
+					GetContainerForWrite()[idx] = typename TriggerType::type();
+				}
 
 				container_type const& GetContainerForRead() const {
 					if (base_) return *base_;
@@ -108,6 +180,11 @@ namespace state
 					if (base_) {
 						handlers_ = *base_; // copy-on-write
 						base_ = nullptr;
+
+						for (size_t idx = 0; borrowed_tombstones_ != 0; ++idx) {
+							if (borrowed_tombstones_ & 1) handlers_[idx] = typename TriggerType::type();
+							borrowed_tombstones_ >>= 1;
+						}
 					}
 					return handlers_;
 				}
@@ -115,6 +192,8 @@ namespace state
 			private:
 				container_type const* base_;
 				container_type handlers_;
+				uint64_t borrowed_tombstones_;
+				size_t tombstones_;
 			};
 		}
 	}
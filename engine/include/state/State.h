@@ -3,6 +3,7 @@
 #include "state/Types.h"
 #include "state/aura/Manager.h"
 #include "state/board/Board.h"
+#include "state/board/CharacterStats.h"
 #include "state/Cards/Manager.h"
 #include "state/Events/Manager.h"
 #include "state/ZoneChanger.h"
@@ -16,14 +17,23 @@ namespace engine {
 
 namespace state
 {
+	class UndoJournal;
+
+	// Thread safety: No, not even for const access
+	//    GetBoardHash(), GetCharacterStats() and the playable-cards cache fill caches kept in the instance
+	//    (see Cards::CardsHash), so two threads must not read the same instance at the same time.
+	//    Each thread should work on its own copy; a copy made by RefCopy() is fine, since the base is
+	//    only read through Cards::Manager::Get(), which fills no cache.
 	class State
 	{
 		template <CardZone, CardType> friend class ZoneChanger;
+		friend class UndoJournal;
 
 	public:
 		State() :
 			board_(), cards_mgr_(), event_mgr_(), aura_mgr_(),
-			current_player_(), turn_(0), play_order_(1)
+			current_player_(), turn_(0), play_order_(1),
+			character_stats_(), playable_cards_()
 		{}
 
 		void RefCopy(State const& base)
@@ -35,6 +45,32 @@ namespace state
 			current_player_ = base.current_player_;
 			turn_ = base.turn_;
 			play_order_ = base.play_order_;
+			character_stats_ = base.character_stats_;
+			playable_cards_ = base.playable_cards_;
+		}
+
+		// See state::BinarySerializer
+		template <typename Writer>
+		void Save(Writer & writer) const {
+			board_.Save(writer);
+			cards_mgr_.Save(writer);
+			event_mgr_.Save(writer);
+			aura_mgr_.Save(writer);
+			writer.WriteRaw(current_player_);
+			writer.WriteRaw(turn_);
+			writer.WriteRaw(play_order_);
+		}
+
+		template <typename Reader>
+		void Load(Reader & reader) {
+			board_.Load(reader);
+			cards_mgr_.Load(reader);
+			event_mgr_.Load(reader);
+			aura_mgr_.Load(reader);
+			reader.ReadRaw(current_player_);
+			reader.ReadRaw(turn_);
+			reader.ReadRaw(play_order_);
+			InvalidateCaches();
 		}
 
 	public:
@@ -61,6 +97,119 @@ namespace state
 		void SetPlayOrder(int play_order) { play_order_ = play_order; }
 		void IncreasePlayOrder() { ++play_order_; }
 
+		// A hash of the board seen by 'viewer'; the hidden information (e.g., the opponent's hand cards) is masked.
+		// The card part is maintained incrementally by the cards manager, so this is O(1) in the number of cards.
+		// The states covered are those in engine::view::ReducedBoardView, except that the 'attackable' flags
+		//    are replaced by the states deciding them.
+		uint64_t GetBoardHash(PlayerSide viewer) const {
+			uint64_t hash = (uint64_t)turn_;
+			hash = Cards::CardsHash::Mix(hash, current_player_.GetSide());
+			hash = Cards::CardsHash::Mix(hash, viewer);
+			for (PlayerSide side : { kPlayerFirst, kPlayerSecond }) {
+				board::Player const& player = board_.Get(side);
+				hash = Cards::CardsHash::Mix(hash, player.GetResource().GetCurrent());
+				hash = Cards::CardsHash::Mix(hash, player.GetResource().GetTotal());
+				hash = Cards::CardsHash::Mix(hash, player.GetResource().GetCurrentOverloaded());
+				hash = Cards::CardsHash::Mix(hash, player.GetResource().GetNextOverload());
+				hash = Cards::CardsHash::Mix(hash, player.deck_.Size());
+			}
+			return Cards::CardsHash::Finalize(hash) ^ cards_mgr_.GetHash(viewer);
+		}
+
+		// The stats of the characters on one side, in structure-of-arrays form
+		// Kept in sync lazily: if only some cards have changed since the last call, only the slots of those
+		//    cards are refilled (see Cards::Card::GetChangeStamp()); a change of the minions, the hero or
+		//    the weapon rebuilds all the slots.
+		board::CharacterStats const& GetCharacterStats(PlayerIdentifier player) const {
+			board::Player const& board_player = board_.Get(player);
+			CharacterStatsCache & cache = character_stats_[player.GetSide() == kPlayerFirst ? 0 : 1];
+			int cards_change_id = cards_mgr_.GetChangeId();
+			if (!cache.valid ||
+				cache.minions_change_id != board_player.minions_.GetChangeId() ||
+				cache.hero_ref_change_id != board_player.GetHeroRefChangeId() ||
+				cache.weapon_ref != board_player.GetWeaponRef())
+			{
+				cache.valid = true;
+				cache.minions_change_id = board_player.minions_.GetChangeId();
+				cache.hero_ref_change_id = board_player.GetHeroRefChangeId();
+				cache.weapon_ref = board_player.GetWeaponRef();
+				BuildCharacterStats(player, board_player, cache.stats);
+			}
+			else if (cache.cards_change_id != cards_change_id) {
+				SyncCharacterStats(board_player, cache.cards_change_id, cache.stats);
+			}
+			cache.cards_change_id = cards_change_id;
+			assert(IsCharacterStatsInSync(player, cache.stats));
+			return cache.stats;
+		}
+
+		// The hand cards playable by the current player, as a mask over the hand indices
+		// Computed and stored by engine::FlowControl::ValidActionGetter. The cached mask is used only if
+		//    none of the hand, the minions, the deck, the resource, the cards, and the event handlers
+		//    (e.g., GetPlayCardCost) has changed since. A secret is played or revealed by moving its card,
+		//    so the secrets are covered by the cards.
+		struct PlayableCardsKey {
+			PlayableCardsKey() :
+				current_player(), turn(0), cards_change_id(0), events_change_id(0), hand_change_id(0),
+				deck_change_id(0), minions_change_ids(), resource_current(0), resource_total(0),
+				resource_overloaded(0)
+			{}
+
+			bool operator==(PlayableCardsKey const& rhs) const {
+				return current_player == rhs.current_player &&
+					turn == rhs.turn &&
+					cards_change_id == rhs.cards_change_id &&
+					events_change_id == rhs.events_change_id &&
+					hand_change_id == rhs.hand_change_id &&
+					deck_change_id == rhs.deck_change_id &&
+					minions_change_ids == rhs.minions_change_ids &&
+					resource_current == rhs.resource_current &&
+					resource_total == rhs.resource_total &&
+					resource_overloaded == rhs.resource_overloaded;
+			}
+			bool operator!=(PlayableCardsKey const& rhs) const { return !(*this == rhs); }
+
+			PlayerIdentifier current_player;
+			int turn;
+			int cards_change_id;
+			int events_change_id;
+			int hand_change_id;
+			int deck_change_id;
+			std::array<int, 2> minions_change_ids;
+			int resource_current;
+			int resource_total;
+			int resource_overloaded;
+		};
+
+		PlayableCardsKey GetPlayableCardsKey() const {
+			board::Player const& player = board_.Get(current_player_);
+			PlayableCardsKey key;
+			key.current_player = current_player_;
+			key.turn = turn_;
+			key.cards_change_id = cards_mgr_.GetChangeId();
+			key.events_change_id = event_mgr_.GetChangeId();
+			key.hand_change_id = player.hand_.GetChangeId();
+			key.deck_change_id = player.deck_.GetChangeId();
+			key.minions_change_ids[0] = board_.GetFirst().minions_.GetChangeId();
+			key.minions_change_ids[1] = board_.GetSecond().minions_.GetChangeId();
+			key.resource_current = player.GetResource().GetCurrent();
+			key.resource_total = player.GetResource().GetTotal();
+			key.resource_overloaded = player.GetResource().GetCurrentOverloaded();
+			return key;
+		}
+
+		bool GetCachedPlayableCards(PlayableCardsKey const& key, uint32_t * mask) const {
+			if (!playable_cards_.valid || playable_cards_.key != key) return false;
+			*mask = playable_cards_.mask;
+			return true;
+		}
+
+		void SetCachedPlayableCards(PlayableCardsKey const& key, uint32_t mask) const {
+			playable_cards_.valid = true;
+			playable_cards_.key = key;
+			playable_cards_.mask = mask;
+		}
+
 	public: // bridge to cards manager
 		Cards::Card const& GetCard(CardRef ref) const { return cards_mgr_.Get(ref); }
 		Cards::Card & GetMutableCard(CardRef ref) { return cards_mgr_.GetMutable(ref); }
@@ -105,6 +254,8 @@ namespace state
 		}
 
 	public: // bridge to event manager
+		void CompactEvents() { event_mgr_.Compact(); }
+
 		template <typename EventType, typename T>
 		void AddEvent(T&& handler) {
 			return event_mgr_.PushBack<EventType, T>(std::forward<T>(handler));
@@ -161,6 +312,91 @@ namespace state
 			return ZoneChangerType(*this, board_, cards_mgr_, ref);
 		}
 
+	private:
+		void InvalidateCaches() {
+			for (auto & cache : character_stats_) cache.valid = false;
+			playable_cards_.valid = false;
+		}
+
+		void FillCharacterStats(int idx, CardRef ref, board::CharacterStats & stats) const {
+			Cards::Card const& card = GetCard(ref);
+			stats.refs[idx] = ref;
+			stats.attack[idx] = card.GetAttack();
+			stats.hp[idx] = card.GetHP();
+			stats.max_hp[idx] = card.GetMaxHP();
+			stats.race[idx] = card.GetRace();
+
+			uint8_t flags = 0;
+			if (card.HasTaunt()) flags |= board::CharacterStats::kFlagTaunt;
+			if (card.HasShield()) flags |= board::CharacterStats::kFlagShield;
+			if (card.HasStealth()) flags |= board::CharacterStats::kFlagStealth;
+			if (card.GetImmune()) flags |= board::CharacterStats::kFlagImmune;
+			if (card.IsImmuneToSpell()) flags |= board::CharacterStats::kFlagImmuneToSpell;
+			if (card.HasCharge()) flags |= board::CharacterStats::kFlagCharge;
+			if (card.GetPendingDestroy()) flags |= board::CharacterStats::kFlagPendingDestroy;
+			if (card.IsReadyToAttack() && GetCardAttackConsiderWeapon(card) > 0) {
+				flags |= board::CharacterStats::kFlagAttackable;
+			}
+			stats.flags[idx] = flags;
+		}
+
+		void BuildCharacterStats(PlayerIdentifier player, board::Player const& board_player, board::CharacterStats & stats) const {
+			stats.owner = player;
+			stats.minions_count = 0;
+			board_player.minions_.ForEach([&](CardRef ref) {
+				assert(stats.minions_count < board::CharacterStats::kHeroIndex);
+				FillCharacterStats(stats.minions_count, ref, stats);
+				++stats.minions_count;
+				return true;
+			});
+
+			CardRef hero_ref = board_player.GetHeroRef();
+			if (hero_ref.IsValid()) {
+				FillCharacterStats(board::CharacterStats::kHeroIndex, hero_ref, stats);
+			}
+			else {
+				stats.refs[board::CharacterStats::kHeroIndex] = hero_ref;
+				stats.flags[board::CharacterStats::kHeroIndex] = 0;
+			}
+		}
+
+		// Refill the slots of the cards modified after the cards manager's change id was 'synced_change_id'
+		// The characters themselves are unchanged, since the minions, the hero and the weapon are unchanged.
+		void SyncCharacterStats(board::Player const& board_player, int synced_change_id, board::CharacterStats & stats) const {
+			for (int idx = 0; idx < stats.minions_count; ++idx) {
+				if (GetCard(stats.refs[idx]).GetChangeStamp() > synced_change_id) {
+					FillCharacterStats(idx, stats.refs[idx], stats);
+				}
+			}
+
+			CardRef hero_ref = stats.refs[board::CharacterStats::kHeroIndex];
+			if (!hero_ref.IsValid()) return;
+			bool hero_changed = GetCard(hero_ref).GetChangeStamp() > synced_change_id;
+			CardRef weapon_ref = board_player.GetWeaponRef();
+			if (weapon_ref.IsValid() && GetCard(weapon_ref).GetChangeStamp() > synced_change_id) {
+				hero_changed = true; // the weapon attack decides if the hero is attackable
+			}
+			if (hero_changed) FillCharacterStats(board::CharacterStats::kHeroIndex, hero_ref, stats);
+		}
+
+		// Debug cross-check of the incremental sync against a full rebuild
+		bool IsCharacterStatsInSync(PlayerIdentifier player, board::CharacterStats const& stats) const {
+			board::CharacterStats expected;
+			BuildCharacterStats(player, board_.Get(player), expected);
+			if (stats.minions_count != expected.minions_count) return false;
+			for (int idx = 0; idx < board::CharacterStats::kMaxCharacters; ++idx) {
+				if (idx >= stats.minions_count && idx != board::CharacterStats::kHeroIndex) continue;
+				if (stats.refs[idx] != expected.refs[idx]) return false;
+				if (stats.flags[idx] != expected.flags[idx]) return false;
+				if (!expected.refs[idx].IsValid()) continue;
+				if (stats.attack[idx] != expected.attack[idx]) return false;
+				if (stats.hp[idx] != expected.hp[idx]) return false;
+				if (stats.max_hp[idx] != expected.max_hp[idx]) return false;
+				if (stats.race[idx] != expected.race[idx]) return false;
+			}
+			return true;
+		}
+
 	private:
 		board::Board board_;
 		Cards::Manager cards_mgr_;
@@ -170,5 +406,29 @@ namespace state
 		PlayerIdentifier current_player_;
 		int turn_;
 		int play_order_;
+
+		struct CharacterStatsCache {
+			CharacterStatsCache() :
+				valid(false), cards_change_id(0), minions_change_id(0), hero_ref_change_id(0),
+				weapon_ref(), stats()
+			{}
+
+			bool valid;
+			int cards_change_id;
+			int minions_change_id;
+			int hero_ref_change_id;
+			CardRef weapon_ref;
+			board::CharacterStats stats;
+		};
+		mutable std::array<CharacterStatsCache, 2> character_stats_;
+
+		struct PlayableCardsCache {
+			PlayableCardsCache() : valid(false), key(), mask(0) {}
+
+			bool valid;
+			PlayableCardsKey key;
+			uint32_t mask;
+		};
+		mutable PlayableCardsCache playable_cards_;
 	};
 }
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <assert.h>
+#include <vector>
+#include "state/State.h"
+#include "state/Cards/CardsJournal.h"
+
+namespace state
+{
+	// Journal to undo actions in LIFO order
+	// Each frame (usually one action; see engine::FlowControl::FlowController::PerformAction()) records
+	//    - the before-image of each modified card, captured by Cards::Manager::GetMutable()
+	//    - a snapshot of the board, the event handlers, the auras and the scalars
+	// The frames are kept in buffers which are reused, so no allocation is needed once warmed up.
+	class UndoJournal
+	{
+	public:
+		UndoJournal() : frames_(), depth_(0), cards_journal_(), recording_(nullptr) {}
+
+		UndoJournal(UndoJournal const&) = delete;
+		UndoJournal & operator=(UndoJournal const&) = delete;
+
+		void Begin(State & state) {
+			assert(recording_ == nullptr);
+			recording_ = &state;
+
+			if (depth_ == frames_.size()) frames_.emplace_back();
+			Frame & frame = frames_[depth_];
+			++depth_;
+
+			frame.board = state.board_;
+			frame.event_mgr = state.event_mgr_;
+			frame.aura_mgr = state.aura_mgr_;
+			frame.current_player = state.current_player_;
+			frame.turn = state.turn_;
+			frame.play_order = state.play_order_;
+			frame.cards_count = state.cards_mgr_.GetCount();
+			frame.card_records_begin = cards_journal_.GetRecordsCount();
+
+			cards_journal_.BeginFrame(frame.cards_count);
+			state.cards_mgr_.SetJournal(&cards_journal_);
+		}
+
+		void End(State & state) {
+			assert(recording_ == &state);
+			state.cards_mgr_.SetJournal(nullptr);
+			recording_ = nullptr;
+		}
+
+		size_t GetDepth() const { return depth_; }
+		bool Empty() const { return depth_ == 0; }
+
+		void Clear() {
+			assert(recording_ == nullptr);
+			depth_ = 0;
+			cards_journal_.Clear();
+		}
+
+		// Restore the state to the beginning of the last frame
+		// The state should be the one recorded
+		void Undo(State & state) {
+			assert(recording_ == nullptr);
+			assert(depth_ > 0);
+			--depth_;
+			Frame const& frame = frames_[depth_];
+
+			state.cards_mgr_.Truncate(frame.cards_count);
+			cards_journal_.PopRecords(frame.card_records_begin, [&](int idx, bool was_set, Cards::Card const& card) {
+				state.cards_mgr_.Restore(idx, was_set, card);
+			});
+
+			state.board_ = frame.board;
+			state.event_mgr_ = frame.event_mgr;
+			state.aura_mgr_ = frame.aura_mgr;
+			state.current_player_ = frame.current_player;
+			state.turn_ = frame.turn;
+			state.play_order_ = frame.play_order;
+			state.InvalidateCaches();
+		}
+
+	private:
+		struct Frame {
+			Frame() :
+				board(), event_mgr(), aura_mgr(), current_player(), turn(0), play_order(0),
+				cards_count(0), card_records_begin(0)
+			{}
+
+			board::Board board;
+			Events::Manager event_mgr;
+			aura::Manager aura_mgr;
+			PlayerIdentifier current_player;
+			int turn;
+			int play_order;
+
+			size_t cards_count;
+			size_t card_records_begin;
+		};
+
+		std::vector<Frame> frames_;
+		size_t depth_;
+		Cards::CardsJournal cards_journal_;
+		State * recording_;
+	};
+}
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <vector>
+#include "Utils/NeverShrinkVector.h"
 #include "state/Types.h"
 #include "engine/FlowControl/aura/Handler.h"
 
@@ -17,18 +17,30 @@ namespace state {
 
 			template <typename Functor> // Functor = bool(FlowControl::aura::Handler &). returns false to remove it from container
 			void ForEachAura(Functor&& functor) {
-				for (auto it = auras_.begin(); it != auras_.end();) {
-					if (!functor(*it)) {
-						it = auras_.erase(it);
-					}
-					else {
-						++it;
-					}
+				// The removed handlers are overwritten by copy, so the buffers they hold are reused
+				size_t kept = 0;
+				for (size_t idx = 0; idx < auras_.size(); ++idx) {
+					if (!functor(auras_[idx])) continue;
+					if (kept != idx) auras_[kept] = auras_[idx];
+					++kept;
 				}
+				auras_.resize(kept);
+			}
+
+			template <typename Writer>
+			void Save(Writer & writer) const {
+				writer.WriteSize(auras_.size());
+				for (auto const& aura : auras_) aura.Save(writer);
+			}
+
+			template <typename Reader>
+			void Load(Reader & reader) {
+				auras_.resize(reader.ReadSize());
+				for (auto & aura : auras_) aura.Load(reader);
 			}
 
 		private:
-			std::vector<engine::FlowControl::aura::Handler> auras_;
+			Utils::NeverShrinkVector<engine::FlowControl::aura::Handler> auras_;
 		};
 	}
 }
\ No newline at end of file
@@ -39,6 +39,18 @@ namespace state
 			Player & GetSecond() { return second_; }
 			Player const& GetSecond() const { return second_; }
 
+			template <typename Writer>
+			void Save(Writer & writer) const {
+				first_.Save(writer);
+				second_.Save(writer);
+			}
+
+			template <typename Reader>
+			void Load(Reader & reader) {
+				first_.Load(reader);
+				second_.Load(reader);
+			}
+
 		private:
 			Player first_;
 			Player second_;
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdint.h>
+#include <array>
+#include "state/Types.h"
+
+namespace state
+{
+	namespace board
+	{
+		// A structure-of-arrays copy of the stats of the characters on one side of the board
+		//    Index 0 ~ 6: minions from left to right
+		//    Index 7: hero
+		// (the same encoding as the attacker index in engine::FlowControl::ValidActionGetter)
+		// Built by state::State::GetCharacterStats(), which rebuilds it only after a card or the minions have changed.
+		class CharacterStats
+		{
+		public:
+			static constexpr int kHeroIndex = 7;
+			static constexpr int kMaxCharacters = 8;
+
+			enum Flag : uint8_t
+			{
+				kFlagTaunt = 1 << 0,
+				kFlagShield = 1 << 1,
+				kFlagStealth = 1 << 2,
+				kFlagImmune = 1 << 3,
+				kFlagImmuneToSpell = 1 << 4,
+				kFlagCharge = 1 << 5,
+				kFlagPendingDestroy = 1 << 6,
+				kFlagAttackable = 1 << 7 // considering the weapon for hero
+			};
+
+			CharacterStats() :
+				owner(), minions_count(0), refs(), attack(), hp(), max_hp(), race(), flags()
+			{}
+
+			bool HasFlag(int idx, Flag flag) const { return (flags[idx] & flag) != 0; }
+			bool IsAttackable(int idx) const { return HasFlag(idx, kFlagAttackable); }
+
+			PlayerIdentifier owner;
+			int minions_count;
+			std::array<CardRef, kMaxCharacters> refs;
+			std::array<int, kMaxCharacters> attack; // not considering the weapon
+			std::array<int, kMaxCharacters> hp;
+			std::array<int, kMaxCharacters> max_hp;
+			std::array<CardRace, kMaxCharacters> race;
+			std::array<uint8_t, kMaxCharacters> flags;
+		};
+	}
+}
@@ -16,8 +16,10 @@ namespace state
 		{
 			template <CardType TargetCardType, CardZone TargetCardZone> friend struct state::detail::PlayerDataStructureMaintainer;
 			
-		private:
+		public:
 			constexpr static int max_size = 80;
+
+		private:
 			using CardsContainer = std::array< ::Cards::CardId, max_size>;
 
 		public:
@@ -30,6 +32,14 @@ namespace state
 				cards_(rhs.cards_)
 			{}
 
+			Deck & operator=(Deck const& rhs) {
+				change_id_ = rhs.change_id_;
+				size_ = rhs.size_;
+				base_cards_ = rhs.base_cards_;
+				cards_ = rhs.cards_;
+				return *this;
+			}
+
 			void RefCopy(Deck const& base) {
 				assert(base.base_cards_ == nullptr);
 
@@ -91,6 +101,22 @@ namespace state
 				return GetCards()[idx];
 			}
 
+			template <typename Writer>
+			void Save(Writer & writer) const {
+				writer.WriteRaw(change_id_);
+				writer.WriteSize(size_);
+				auto const& container = GetCards();
+				for (int i = 0; i < size_; ++i) writer.WriteRaw(container[i]);
+			}
+
+			template <typename Reader>
+			void Load(Reader & reader) {
+				reader.ReadRaw(change_id_);
+				size_ = (int)reader.ReadSize(max_size);
+				base_cards_ = nullptr;
+				for (int i = 0; i < size_; ++i) reader.ReadRaw(cards_[i]);
+			}
+
 		private:
 			CardsContainer const& GetCards() const {
 				if (base_cards_) return *base_cards_;
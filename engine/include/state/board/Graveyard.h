@@ -53,6 +53,20 @@ namespace state
 					return GetContainerForRead().size();
 				}
 
+				template <typename Writer>
+				void Save(Writer & writer) const {
+					auto const& items = GetContainerForRead();
+					writer.WriteSize(items.size());
+					for (CardRef ref : items) writer.WriteRaw(ref);
+				}
+
+				template <typename Reader>
+				void Load(Reader & reader) {
+					base_ = nullptr;
+					items_.resize(reader.ReadSize());
+					for (CardRef & ref : items_) reader.ReadRaw(ref);
+				}
+
 			private:
 				using InternalContainerType = std::vector<CardRef>;
 
@@ -87,6 +101,20 @@ namespace state
 			size_t GetTotalSpells() const { return spells_.size(); }
 			size_t GetTotalOthers() const { return others_.size(); }
 
+			template <typename Writer>
+			void Save(Writer & writer) const {
+				minions_.Save(writer);
+				spells_.Save(writer);
+				others_.Save(writer);
+			}
+
+			template <typename Reader>
+			void Load(Reader & reader) {
+				minions_.Load(reader);
+				spells_.Load(reader);
+				others_.Load(reader);
+			}
+
 		private:
 			template <CardType AddingType> void Add(CardRef ref);
 			template <CardType RemovingType> void Remove(CardRef ref);
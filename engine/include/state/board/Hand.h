@@ -43,6 +43,20 @@ namespace state
 				}
 			}
 
+			template <typename Writer>
+			void Save(Writer & writer) const {
+				writer.WriteRaw(change_id_);
+				writer.WriteSize(size_);
+				for (size_t i = 0; i < size_; ++i) writer.WriteRaw(cards_[i]);
+			}
+
+			template <typename Reader>
+			void Load(Reader & reader) {
+				reader.ReadRaw(change_id_);
+				size_ = reader.ReadSize(max_cards_);
+				for (size_t i = 0; i < size_; ++i) reader.ReadRaw(cards_[i]);
+			}
+
 		private:
 			template <typename CardIdGetter>
 			size_t Add(CardRef ref, CardIdGetter card_id_getter)
@@ -1,8 +1,8 @@
 #pragma once
 
-#include <vector>
 #include <algorithm>
 #include "state/Types.h"
+#include "Utils/FixedCapacityVector.h"
 
 namespace state
 {
@@ -15,10 +15,9 @@ namespace state
 			template <CardType TargetCardType, CardZone TargetCardZone> friend struct state::detail::PlayerDataStructureMaintainer;
 
 		public:
-			Minions() : minions_(), change_id_(0)
-			{
-				minions_.reserve(max_size_);
-			}
+			typedef Utils::FixedCapacityVector<CardRef, 7> Container;
+
+			Minions() : minions_(), change_id_(0) {}
 
 			void RefCopy(Minions const& base) {
 				minions_ = base.minions_;
@@ -30,14 +29,14 @@ namespace state
 				assert(pos <= minions_.size());
 				return minions_[pos];
 			}
-			std::vector<CardRef> const& GetAll() const { return minions_; }
+			Container const& GetAll() const { return minions_; }
 			void Replace(size_t pos, CardRef new_card_ref) {
 				minions_[pos] = new_card_ref;
 				++change_id_;
 			}
 			bool Full() const { return Size() >= max_size_; }
 
-			std::vector<CardRef> const& Get() const { return minions_; }
+			Container const& Get() const { return minions_; }
 			int GetChangeId() const { return change_id_; }
 			void IncreaseChangeId() { ++change_id_; }
 
@@ -49,11 +48,29 @@ namespace state
 				return true;
 			}
 
+			template <typename Writer>
+			void Save(Writer & writer) const {
+				writer.WriteRaw(change_id_);
+				writer.WriteSize(minions_.size());
+				for (CardRef ref : minions_) writer.WriteRaw(ref);
+			}
+
+			template <typename Reader>
+			void Load(Reader & reader) {
+				reader.ReadRaw(change_id_);
+				minions_.clear();
+				size_t size = reader.ReadSize(max_size_);
+				for (size_t i = 0; i < size; ++i) {
+					CardRef ref;
+					reader.ReadRaw(ref);
+					minions_.push_back(ref);
+				}
+			}
+
 		private:
 			template <typename AdjustFunctor>
 			void Insert(CardRef ref, size_t pos, AdjustFunctor&& functor)
 			{
-				assert(pos >= 0);
 				assert(pos <= minions_.size());
 				assert(!Full());
 
@@ -82,8 +99,8 @@ namespace state
 			}
 
 		private:
-			static constexpr int max_size_ = 7;
-			std::vector<CardRef> minions_; // TODO: use std::array?
+			static constexpr int max_size_ = (int)Container::capacity();
+			Container minions_;
 			int change_id_;
 		};
 	}
@@ -62,6 +62,40 @@ namespace state
 				played_cards_this_turn_ = 0;
 			}
 
+			template <typename Writer>
+			void Save(Writer & writer) const {
+				deck_.Save(writer);
+				hand_.Save(writer);
+				minions_.Save(writer);
+				secrets_.Save(writer);
+				graveyard_.Save(writer);
+				writer.WriteRaw(played_minions_this_turn_);
+				writer.WriteRaw(played_cards_this_turn_);
+				writer.WriteRaw(hero_ref_);
+				writer.WriteRaw(hero_ref_change_id_);
+				writer.WriteRaw(hero_power_ref_);
+				writer.WriteRaw(weapon_ref_);
+				writer.WriteRaw(resource_);
+				writer.WriteRaw(fatigue_damage_);
+			}
+
+			template <typename Reader>
+			void Load(Reader & reader) {
+				deck_.Load(reader);
+				hand_.Load(reader);
+				minions_.Load(reader);
+				secrets_.Load(reader);
+				graveyard_.Load(reader);
+				reader.ReadRaw(played_minions_this_turn_);
+				reader.ReadRaw(played_cards_this_turn_);
+				reader.ReadRaw(hero_ref_);
+				reader.ReadRaw(hero_ref_change_id_);
+				reader.ReadRaw(hero_power_ref_);
+				reader.ReadRaw(weapon_ref_);
+				reader.ReadRaw(resource_);
+				reader.ReadRaw(fatigue_damage_);
+			}
+
 		private: // restrict access to zone changer
 			void SetHeroRef(CardRef ref) {
 				hero_ref_ = ref;
@@ -1,9 +1,10 @@
 #pragma once
 
-#include <string>
-#include <unordered_map>
+#include <assert.h>
+#include <stdexcept>
 #include "state/Types.h"
 #include "Cards/id-map.h"
+#include "Utils/FixedCapacityVector.h"
 
 namespace state
 {
@@ -11,75 +12,96 @@ namespace state
 
 	namespace board
 	{
+		// A player can hold at most five secrets, so they are kept in an inline array,
+		// and looked up by a linear scan
 		class Secrets
 		{
+		public:
+			static constexpr size_t kMaxSecrets = 5;
+
 		private:
-			using ContainerType = std::unordered_map<int, CardRef>;
+			struct Item {
+				Item() : card_id(), card() {}
+				Item(::Cards::CardId new_card_id, CardRef new_card) : card_id(new_card_id), card(new_card) {}
 
-		public:
-			Secrets() : base_(nullptr), secrets_() {}
+				::Cards::CardId card_id;
+				CardRef card;
+			};
+			using ContainerType = Utils::FixedCapacityVector<Item, kMaxSecrets>;
 
-			Secrets(Secrets const& rhs) : base_(rhs.base_), secrets_(rhs.secrets_) {}
-			Secrets & operator=(Secrets const& rhs) {
-				base_ = rhs.base_;
-				secrets_ = rhs.secrets_;
-				return *this;
-			}
+		public:
+			Secrets() : secrets_() {}
 
+			// The items are stored inline, so a copy is as cheap as borrowing from the base
 			void RefCopy(Secrets const& base) {
-				assert(base.base_ == nullptr);
-				base_ = &base.secrets_;
+				secrets_ = base.secrets_;
 			}
 
 			bool Exists(::Cards::CardId card_id) const
 			{
-				ContainerType const& container = GetContainer();
-				return container.find((int)card_id) != container.end();
+				for (auto const& item : secrets_) {
+					if (item.card_id == card_id) return true;
+				}
+				return false;
 			}
 
+			// The functor is called on a snapshot, so it can remove secrets
 			template <typename Functor>
 			void ForEach(Functor&& functor) const {
-				ContainerType const& container = GetContainer();
-				for (auto const& kv : container) {
-					functor(kv.second);
+				ContainerType const snapshot = secrets_;
+				for (auto const& item : snapshot) {
+					functor(item.card);
 				}
 			}
 
-			bool Empty() const { return GetContainer().empty(); }
+			bool Empty() const { return secrets_.empty(); }
+			bool Full() const { return secrets_.size() >= kMaxSecrets; }
 
 			void Add(::Cards::CardId card_id, CardRef card)
 			{
 				if (Exists(card_id)) throw std::runtime_error("Secret already exists");
-				GetContainerForWrite().insert(std::make_pair((int)card_id, card));
+				if (Full()) throw std::runtime_error("Too many secrets");
+				secrets_.push_back(Item(card_id, card));
 			}
 
 			void Remove(::Cards::CardId card_id)
 			{
-				GetContainerForWrite().erase(card_id);
+				for (auto it = secrets_.begin(); it != secrets_.end(); ++it) {
+					if (it->card_id == card_id) {
+						secrets_.erase(it);
+						return;
+					}
+				}
 			}
 
 			void Clear()
 			{
-				GetContainerForWrite().clear();
+				secrets_.clear();
 			}
 
-		private:
-			ContainerType & GetContainerForWrite() {
-				if (base_) {
-					secrets_ = *base_;
-					base_ = nullptr;
+			template <typename Writer>
+			void Save(Writer & writer) const {
+				writer.WriteSize(secrets_.size());
+				for (auto const& item : secrets_) {
+					writer.WriteRaw(item.card_id);
+					writer.WriteRaw(item.card);
 				}
-				return secrets_;
 			}
 
-			ContainerType const& GetContainer() const {
-				if (base_) return *base_;
-				else return secrets_;
+			template <typename Reader>
+			void Load(Reader & reader) {
+				secrets_.clear();
+				size_t size = reader.ReadSize(kMaxSecrets);
+				for (size_t i = 0; i < size; ++i) {
+					Item item;
+					reader.ReadRaw(item.card_id);
+					reader.ReadRaw(item.card);
+					secrets_.push_back(item);
+				}
 			}
 
 		private:
-			ContainerType const* base_;
 			ContainerType secrets_;
 		};
 	}
-}
\ No newline at end of file
+}
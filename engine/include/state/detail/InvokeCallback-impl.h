@@ -11,7 +11,7 @@ namespace state {
 			state::State & state, state::CardRef card_ref)
 		{
 			state.GetMutableCard(card_ref).SetJustPlayedFlag(true);
-			state.GetMutableCard(card_ref).GetRawData()
+			state.GetCard(card_ref).GetHandlers()
 				.added_to_play_zone(state::Cards::ZoneChangedContext
 				{ state, card_ref});
 		}
@@ -20,7 +20,7 @@ namespace state {
 		inline void InvokeCallback<CardType, kCardZoneHand>::Added(
 			state::State & state, state::CardRef card_ref)
 		{
-			state.GetMutableCard(card_ref).GetRawData()
+			state.GetCard(card_ref).GetHandlers()
 				.added_to_hand_zone(state::Cards::ZoneChangedContext{state, card_ref});
 		}
 	}
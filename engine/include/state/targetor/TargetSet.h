@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdint.h>
+#include "Utils/Bits.h"
+#include "state/Types.h"
+#include "state/board/CharacterStats.h"
+
+namespace state {
+	class State;
+
+	namespace targetor {
+		// A set of characters as a 16-bit mask
+		//    Bit 0: hero of the first player
+		//    Bit 1 ~ 7: minions of the first player, from left to right
+		//    Bit 8 ~ 15: the same for the second player
+		// The bit order is the order of Targets::Fill(). A set refers to the board when it was made,
+		//    so it should be resolved to card refs before the board changes.
+		class TargetSet
+		{
+		public:
+			static constexpr int kBitsPerPlayer = board::CharacterStats::kMaxCharacters;
+
+			TargetSet() : mask_(0) {}
+			explicit TargetSet(uint32_t mask) : mask_(mask) {}
+
+			// 'player_mask' is indexed as in board::CharacterStats (minions first, and then the hero)
+			static TargetSet FromCharacterStatsMask(PlayerIdentifier player, uint32_t player_mask) {
+				assert(player_mask < (1u << kBitsPerPlayer));
+				constexpr int kHeroIndex = board::CharacterStats::kHeroIndex;
+				uint32_t mask = ((player_mask << 1) | (player_mask >> kHeroIndex)) & ((1u << kBitsPerPlayer) - 1);
+				if (player.GetSide() == kPlayerSecond) mask <<= kBitsPerPlayer;
+				return TargetSet(mask);
+			}
+
+			TargetSet operator|(TargetSet rhs) const { return TargetSet(mask_ | rhs.mask_); }
+
+			uint32_t GetMask() const { return mask_; }
+			bool Empty() const { return mask_ == 0; }
+			int Count() const { return Utils::PopCount(mask_); }
+
+			// The n-th (zero-based) target
+			CardRef Get(State const& state, int n) const { return GetByBit(state, Utils::SelectBit(mask_, n)); }
+
+			template <typename Functor>
+			void ForEach(State const& state, Functor&& functor) const {
+				for (uint32_t mask = mask_; mask; mask &= mask - 1) {
+					if (!functor(GetByBit(state, Utils::CountTrailingZeros(mask)))) return;
+				}
+			}
+
+			template <typename Container> // a vector-like container
+			void Fill(State const& state, Container& targets) const {
+				ForEach(state, [&](CardRef ref) {
+					targets.push_back(ref);
+					return true;
+				});
+			}
+
+		private:
+			static CardRef GetByBit(State const& state, int bit);
+
+		private:
+			uint32_t mask_;
+		};
+	}
+}
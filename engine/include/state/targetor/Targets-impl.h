@@ -7,121 +7,162 @@
 
 namespace state {
 	namespace targetor {
-		inline void Targets::Fill(state::State const& state, std::vector<CardRef>& targets) const {
-			Process(state, [&](CardRef ref) {
-				targets.push_back(ref);
-				return true;
-			});
+		namespace detail {
+			// One bit per character; the loop has no branches, so it can be vectorized
+			template <typename Predicate>
+			inline uint32_t MakeCharacterStatsMask(Predicate&& predicate) {
+				uint32_t mask = 0;
+				for (int idx = 0; idx < board::CharacterStats::kMaxCharacters; ++idx) {
+					mask |= (uint32_t)(predicate(idx) ? 1 : 0) << idx;
+				}
+				return mask;
+			}
+
+			inline uint32_t MakeFlagMask(board::CharacterStats const& stats, board::CharacterStats::Flag flag) {
+				return MakeCharacterStatsMask([&](int idx) { return (stats.flags[idx] & flag) != 0; });
+			}
 		}
-		inline void Targets::Fill(state::State const& state, std::unordered_set<CardRef>& targets) const {
-			Process(state, [&](CardRef ref) {
-				targets.insert(ref);
-				return true;
-			});
+
+		inline CardRef TargetSet::GetByBit(State const& state, int bit) {
+			PlayerIdentifier player = (bit < kBitsPerPlayer) ? PlayerIdentifier::First() : PlayerIdentifier::Second();
+			int bit_in_player = bit % kBitsPerPlayer;
+			int idx = (bit_in_player == 0) ? board::CharacterStats::kHeroIndex : (bit_in_player - 1);
+			CardRef ref = state.GetCharacterStats(player).refs[idx];
+			assert(ref.IsValid());
+			return ref;
 		}
 
-		template <typename Functor>
-		inline void Targets::ForEach(state::State const& state, Functor&& func) const {
-			Process(state, [&](CardRef ref) {
-				return func(ref);
-			});
+		inline TargetSet Targets::GetTargetSet(state::State const& state) const {
+			TargetSet ret;
+			if (include_first) {
+				PlayerIdentifier player = PlayerIdentifier::First();
+				ret = ret | TargetSet::FromCharacterStatsMask(player, GetCharacterStatsMask(state.GetCharacterStats(player)));
+			}
+			if (include_second) {
+				PlayerIdentifier player = PlayerIdentifier::Second();
+				ret = ret | TargetSet::FromCharacterStatsMask(player, GetCharacterStatsMask(state.GetCharacterStats(player)));
+			}
+			return ret;
 		}
 
-		inline void Targets::Count(state::State const& state, int * count) const {
-			Process(state, [count](CardRef) {
-				++(*count);
+		template <typename Container>
+		inline void Targets::Fill(state::State const& state, Container& targets) const {
+			GetTargetSet(state).Fill(state, targets);
+		}
+		inline void Targets::Fill(state::State const& state, std::unordered_set<CardRef>& targets) const {
+			GetTargetSet(state).ForEach(state, [&](CardRef ref) {
+				targets.insert(ref);
 				return true;
 			});
 		}
 
 		template <typename Functor>
-		inline void Targets::Process(state::State const& state, Functor&& functor) const {
+		inline void Targets::ForEach(state::State const& state, Functor&& func) const {
 			if (include_first) {
-				if (!ProcessPlayerTargets(state, state.GetBoard().GetFirst(), std::forward<Functor>(functor))) return;
+				if (!ProcessPlayerTargets(state, state::PlayerIdentifier::First(), func)) return;
 			}
 			if (include_second) {
-				if (!ProcessPlayerTargets(state, state.GetBoard().GetSecond(), std::forward<Functor>(functor))) return;
+				if (!ProcessPlayerTargets(state, state::PlayerIdentifier::Second(), func)) return;
 			}
 		}
 
+		inline void Targets::Count(state::State const& state, int * count) const {
+			*count += GetTargetSet(state).Count();
+		}
+
 		template <typename Functor>
-		inline bool Targets::ProcessPlayerTargets(state::State const& state, board::Player const& player, Functor&& functor) const {
-			auto op = [&](state::CardRef card_ref) {
-				if (card_ref == exclude) return true;
-				auto const& card = state.GetCard(card_ref);
-				if (!CheckTargetableFilter(state, card)) return true;
-				if (!CheckFilter(state, card)) return true;
-				return functor(card_ref);
+		inline bool Targets::ProcessPlayerTargets(state::State const& state, state::PlayerIdentifier player, Functor&& functor) const {
+			// The functor might modify the state, so the stats are fetched again for each character
+			//    (this is cheap when nothing has changed)
+			auto op = [&](int idx) {
+				board::CharacterStats const& stats = state.GetCharacterStats(player);
+				if (((GetCharacterStatsMask(stats) >> idx) & 1) == 0) return true;
+				return functor(stats.refs[idx]);
 			};
 
 			if (include_hero) {
-				if (!op(player.GetHeroRef())) return false;
+				if (!op(board::CharacterStats::kHeroIndex)) return false;
 			}
 			if (include_minion) {
-				if (!player.minions_.ForEach(op)) return false;
+				for (int idx = 0; idx < state.GetCharacterStats(player).minions_count; ++idx) {
+					if (!op(idx)) return false;
+				}
 			}
 			return true;
 		}
 
-		inline bool Targets::CheckTargetable(state::Cards::Card const & card) const
-		{
-			if (card.GetPlayerIdentifier() != targeting_side) {
-				if (card.HasStealth()) return false;
-				if (card.GetImmune()) return false;
+		inline uint32_t Targets::GetCharacterStatsMask(board::CharacterStats const& stats) const {
+			uint32_t mask = 0;
+			if (include_hero) mask |= 1u << board::CharacterStats::kHeroIndex;
+			if (include_minion) mask |= (1u << stats.minions_count) - 1;
+
+			if (exclude.IsValid()) {
+				mask &= ~detail::MakeCharacterStatsMask([&](int idx) { return stats.refs[idx] == exclude; });
 			}
-			return true;
-		}
 
-		inline bool Targets::CheckTargetableFilter(state::State const& state, state::Cards::Card const& card) const {
 			switch (targetable_type) {
 			case kTargetableTypeAll:
-				return true;
+				break;
 			case kTargetableTypeOnlyTargetable:
-				return CheckTargetable(card);
+				mask &= GetTargetableMask(stats);
+				break;
 			case kTargetableTypeOnlySpellTargetable:
-				if (card.IsImmuneToSpell()) return false;
-				return CheckTargetable(card);
+				mask &= ~detail::MakeFlagMask(stats, board::CharacterStats::kFlagImmuneToSpell);
+				mask &= GetTargetableMask(stats);
+				break;
+			default:
+				assert(false);
 			}
 
-			assert(false);
-			return false;
+			return mask & GetFilterMask(stats);
+		}
+
+		inline uint32_t Targets::GetTargetableMask(board::CharacterStats const& stats) const
+		{
+			constexpr uint32_t kAll = (1u << board::CharacterStats::kMaxCharacters) - 1;
+			if (stats.owner == targeting_side) return kAll;
+			return kAll & ~detail::MakeCharacterStatsMask([&](int idx) {
+				return (stats.flags[idx] & (board::CharacterStats::kFlagStealth | board::CharacterStats::kFlagImmune)) != 0;
+			});
 		}
-		
-		inline bool Targets::CheckFilter(state::State const& state, state::Cards::Card const& card) const {
+
+		inline uint32_t Targets::GetFilterMask(board::CharacterStats const& stats) const {
+			using detail::MakeCharacterStatsMask;
+			using detail::MakeFlagMask;
+			constexpr uint32_t kAll = (1u << board::CharacterStats::kMaxCharacters) - 1;
+
 			switch (filter_type) {
 			case kFilterAll:
-				return true;
+				return kAll;
 			case kFilterAlive:
-				if (card.GetHP() <= 0) return false;
-				if (card.GetRawData().pending_destroy) return false;
-				return true;
+				return MakeCharacterStatsMask([&](int idx) { return stats.hp[idx] > 0; })
+					& ~MakeFlagMask(stats, board::CharacterStats::kFlagPendingDestroy);
 			case kFilterTargetable:
-				if (!CheckTargetable(card)) return false;
-				return true;
+				return GetTargetableMask(stats);
 			case kFilterMurloc:
-				return (card.GetRace() == kCardRaceMurloc);
+				return MakeCharacterStatsMask([&](int idx) { return stats.race[idx] == kCardRaceMurloc; });
 			case kFilterBeast:
-				return (card.GetRace() == kCardRaceBeast);
+				return MakeCharacterStatsMask([&](int idx) { return stats.race[idx] == kCardRaceBeast; });
 			case kFilterPirate:
-				return (card.GetRace() == kCardRacePirate);
+				return MakeCharacterStatsMask([&](int idx) { return stats.race[idx] == kCardRacePirate; });
 			case kFilterDemon:
-				return (card.GetRace() == kCardRaceDemon);
+				return MakeCharacterStatsMask([&](int idx) { return stats.race[idx] == kCardRaceDemon; });
 			case kFilterAttackGreaterOrEqualTo:
-				return (card.GetAttack() >= filter_arg1);
+				return MakeCharacterStatsMask([&](int idx) { return stats.attack[idx] >= filter_arg1; });
 			case kFilterAttackLessOrEqualTo:
-				return (card.GetAttack() <= filter_arg1);
+				return MakeCharacterStatsMask([&](int idx) { return stats.attack[idx] <= filter_arg1; });
 			case kFilterTaunt:
-				return card.HasTaunt();
+				return MakeFlagMask(stats, board::CharacterStats::kFlagTaunt);
 			case kFilterCharge:
-				return card.HasCharge();
+				return MakeFlagMask(stats, board::CharacterStats::kFlagCharge);
 			case kFilterUnDamaged:
-				return (card.GetDamage() <= 0);
+				return MakeCharacterStatsMask([&](int idx) { return stats.hp[idx] >= stats.max_hp[idx]; });
 			case kFilterDamaged:
-				return (card.GetDamage() > 0);
+				return MakeCharacterStatsMask([&](int idx) { return stats.hp[idx] < stats.max_hp[idx]; });
 			}
 
 			assert(false);
-			return false; // fallback
+			return 0; // fallback
 		}
 	}
-}
\ No newline at end of file
+}
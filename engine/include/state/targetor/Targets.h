@@ -1,8 +1,9 @@
 #pragma once
 
-#include <vector>
+#include <stdint.h>
 #include <unordered_set>
 #include "state/Types.h"
+#include "state/targetor/TargetSet.h"
 
 namespace engine {
 	namespace FlowControl { class Manipulate; }
@@ -10,7 +11,6 @@ namespace engine {
 
 namespace state {
 	class State;
-	namespace board { class Player; }
 
 	namespace targetor {
 		class Targets
@@ -45,7 +45,11 @@ namespace state {
 			state::PlayerIdentifier GetTargetingSide() const { return targeting_side; }
 
 		public:
-			void Fill(state::State const& state, std::vector<CardRef>& targets) const;
+			// The targets are evaluated on all characters at once, as a mask (see TargetSet)
+			TargetSet GetTargetSet(state::State const& state) const;
+
+			template <typename Container> // a vector-like container
+			void Fill(state::State const& state, Container& targets) const;
 			void Fill(state::State const& state, std::unordered_set<CardRef>& targets) const;
 
 			template <typename Functor>
@@ -55,15 +59,12 @@ namespace state {
 
 		private:
 			template <typename Functor>
-			void Process(state::State const& state, Functor&& functor) const;
-
-			template <typename Functor>
-			bool ProcessPlayerTargets(state::State const& state, board::Player const& player, Functor&& functor) const;
-
-			bool CheckTargetableFilter(state::State const& state, state::Cards::Card const& card) const;
-			bool CheckFilter(state::State const& state, state::Cards::Card const& card) const;
+			bool ProcessPlayerTargets(state::State const& state, state::PlayerIdentifier player, Functor&& functor) const;
 
-			bool CheckTargetable(state::Cards::Card const& card) const;
+			// Indexed as in board::CharacterStats
+			uint32_t GetCharacterStatsMask(board::CharacterStats const& stats) const;
+			uint32_t GetTargetableMask(board::CharacterStats const& stats) const;
+			uint32_t GetFilterMask(board::CharacterStats const& stats) const;
 
 		public:
 			state::PlayerIdentifier targeting_side; // used to determine if a stealth minion can be targeted
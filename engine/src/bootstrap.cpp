@@ -60,11 +60,24 @@ static void WriteMapHeader()
 	header_file.flush();
 }
 
+static void WriteCompiledDatabase()
+{
+	std::cout << "Writing compiled card database" << std::endl;
+
+	// Cards::Database::Initialize() loads this instead of parsing the json file, if given as the cache path
+	std::string const path = Cards::Database::GetBinaryPath("../../../engine/include/Cards/cards.json");
+	if (!Cards::Database::GetInstance().SaveBinaryFile(path)) {
+		std::cout << "Failed to write compiled card database." << std::endl;
+	}
+}
+
 int main(void)
 {
 	WriteFormattedJson("../../../engine/include/Cards/cards.json", "../../../engine/include/Cards/formatted_cards.json");
 
 	WriteMapHeader();
 
+	WriteCompiledDatabase();
+
 	return 0;
 }
\ No newline at end of file
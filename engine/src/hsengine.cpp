@@ -0,0 +1,9 @@
+// The engine compiled as a library; see engine/Library.h
+// Everything is in one translation unit, so the entry points are defined only once.
+
+#define HSENGINE_BUILD_LIBRARY
+
+#include "engine/Engine.h"
+
+#include "Cards/CardDispatcher-impl.h"
+#include "engine/Game-impl.h"
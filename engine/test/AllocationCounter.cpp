@@ -0,0 +1,57 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <new>
+
+#include "AllocationCounter.h"
+
+// The replaced operators are kept in this translation unit alone, so the compiler never sees
+//    a new-expression paired with the malloc()/free() calls below.
+
+struct AllocationCounterHook
+{
+	static AllocationCounter * active;
+
+	static void * Allocate(size_t size) {
+		if (active) ++active->count_;
+		return malloc(size ? size : 1);
+	}
+
+	static void Free(void * ptr) { free(ptr); }
+};
+
+AllocationCounter * AllocationCounterHook::active = nullptr;
+
+AllocationCounter::AllocationCounter() : count_(0)
+{
+	assert(!AllocationCounterHook::active);
+	AllocationCounterHook::active = this;
+}
+
+AllocationCounter::~AllocationCounter()
+{
+	AllocationCounterHook::active = nullptr;
+}
+
+void * operator new(size_t size)
+{
+	void * ptr = AllocationCounterHook::Allocate(size);
+	if (!ptr) throw std::bad_alloc();
+	return ptr;
+}
+
+void * operator new[](size_t size)
+{
+	void * ptr = AllocationCounterHook::Allocate(size);
+	if (!ptr) throw std::bad_alloc();
+	return ptr;
+}
+
+void * operator new(size_t size, std::nothrow_t const&) noexcept { return AllocationCounterHook::Allocate(size); }
+void * operator new[](size_t size, std::nothrow_t const&) noexcept { return AllocationCounterHook::Allocate(size); }
+
+void operator delete(void * ptr) noexcept { AllocationCounterHook::Free(ptr); }
+void operator delete[](void * ptr) noexcept { AllocationCounterHook::Free(ptr); }
+void operator delete(void * ptr, size_t) noexcept { AllocationCounterHook::Free(ptr); }
+void operator delete[](void * ptr, size_t) noexcept { AllocationCounterHook::Free(ptr); }
+void operator delete(void * ptr, std::nothrow_t const&) noexcept { AllocationCounterHook::Free(ptr); }
+void operator delete[](void * ptr, std::nothrow_t const&) noexcept { AllocationCounterHook::Free(ptr); }
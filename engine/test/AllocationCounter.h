@@ -0,0 +1,20 @@
+#pragma once
+
+// Counts the global allocations (operator new) while an instance is alive
+// The global operators are replaced in AllocationCounter.cpp, which should be linked to the test.
+// Not thread-safe; at most one instance should be alive at a time.
+class AllocationCounter
+{
+public:
+	AllocationCounter();
+	~AllocationCounter();
+
+	AllocationCounter(AllocationCounter const&) = delete;
+	AllocationCounter & operator=(AllocationCounter const&) = delete;
+
+	int GetCount() const { return count_; }
+
+private:
+	friend struct AllocationCounterHook;
+	int count_;
+};
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <assert.h>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "engine/Game.h"
+#include "Cards/Database.h"
+#include "decks/Decks.h"
+
+// Picks every action parameter at random
+class RandomActionGetter : public engine::IActionParameterGetter
+{
+public:
+	RandomActionGetter() : rand_() {}
+
+	void Seed(unsigned int seed) { rand_.seed(seed); }
+
+	int GetNumber(engine::ActionType::Types action_type, engine::ActionChoices const& action_choices) final {
+		assert(!action_choices.Empty());
+		return action_choices.Get(rand_() % action_choices.Size());
+	}
+
+private:
+	std::mt19937 rand_;
+};
+
+// Builds the start states of the tests playing random games with the built-in decks
+class RandomGameBuilder
+{
+public:
+	// The first player holds three hand cards, and has one mana crystal; the second one holds four
+	static state::State GetStartState(std::string const& first_deck, std::string const& second_deck, std::mt19937 & rand)
+	{
+		state::State state;
+		MakePlayer(first_deck, 3, rand, state, state::PlayerIdentifier::First());
+		MakePlayer(second_deck, 4, rand, state, state::PlayerIdentifier::Second());
+		state.GetMutableCurrentPlayerId().SetFirst();
+		state.GetBoard().GetFirst().GetResource().SetTotal(1);
+		state.GetBoard().GetFirst().GetResource().Refill();
+		return state;
+	}
+
+	// The observable states, flattened
+	static std::vector<int> GetSnapshot(state::State const& state)
+	{
+		std::vector<int> ret;
+		ret.push_back(state.GetTurn());
+		ret.push_back(state.GetPlayOrder());
+		ret.push_back(state.GetCurrentPlayerId().GetSide());
+		ret.push_back((int)state.GetBoardHash(state::kPlayerFirst));
+		ret.push_back((int)state.GetBoardHash(state::kPlayerSecond));
+
+		for (state::PlayerSide side : { state::kPlayerFirst, state::kPlayerSecond }) {
+			auto const& player = state.GetBoard().Get(side);
+			ret.push_back(player.deck_.Size());
+			for (int i = 0; i < player.deck_.Size(); ++i) ret.push_back(player.deck_.GetCard(i));
+			ret.push_back((int)player.hand_.Size());
+			for (size_t i = 0; i < player.hand_.Size(); ++i) ret.push_back(player.hand_.Get(i).id);
+			ret.push_back((int)player.minions_.Size());
+			player.minions_.ForEach([&](state::CardRef ref) { ret.push_back(ref.id); return true; });
+			ret.push_back((int)player.graveyard_.GetTotalMinions());
+			ret.push_back(player.GetHeroRef().id);
+			ret.push_back(player.GetWeaponRef().id);
+			ret.push_back(player.GetResource().GetCurrent());
+			ret.push_back(player.GetResource().GetTotal());
+			ret.push_back(player.GetFatigueDamage());
+			ret.push_back(player.played_cards_this_turn_);
+
+			auto const& stats = state.GetCharacterStats(state::PlayerIdentifier(side));
+			for (int i = 0; i < stats.minions_count; ++i) ret.push_back(stats.flags[i]);
+		}
+
+		auto const& cards = state.GetCardsManager();
+		ret.push_back((int)cards.GetCount());
+		cards.ForEach([&](state::CardRef, state::Cards::Card const& card) {
+			ret.push_back(card.GetCardId());
+			ret.push_back(card.GetZone());
+			ret.push_back(card.GetZonePosition());
+			ret.push_back(card.GetPlayerIdentifier().GetSide());
+			ret.push_back(card.GetCost());
+			ret.push_back(card.GetAttack());
+			ret.push_back(card.GetHP());
+			ret.push_back(card.GetMaxHP());
+			ret.push_back(card.GetArmor());
+			ret.push_back(card.GetRawData().num_attacks_this_turn);
+			ret.push_back(card.GetRawData().just_played);
+			ret.push_back(card.HasTaunt());
+			ret.push_back(card.HasShield());
+			ret.push_back(card.IsSilenced());
+			return true;
+		});
+		return ret;
+	}
+
+private:
+	static void AddCard(Cards::CardId id, state::State & state, state::PlayerIdentifier player, state::CardZone zone)
+	{
+		state::Cards::CardData raw_card = Cards::CardDispatcher::CreateInstance(id);
+		raw_card.enchanted_states.player = player;
+		raw_card.enchantment_handler.SetOriginalStates(raw_card.enchanted_states);
+		raw_card.zone = state::kCardZoneNewlyCreated;
+
+		auto ref = state.AddCard(state::Cards::Card(raw_card));
+		if (zone == state::kCardZoneHand) {
+			state.GetZoneChanger<state::kCardZoneNewlyCreated>(ref)
+				.ChangeTo<state::kCardZoneHand>(player);
+		}
+		else {
+			assert(raw_card.card_type == state::kCardTypeHeroPower);
+			state.GetZoneChanger<state::kCardTypeHeroPower, state::kCardZoneNewlyCreated>(ref)
+				.ChangeTo<state::kCardZonePlay>(player);
+		}
+	}
+
+	static void MakePlayer(std::string const& deck_name, int hand_cards, std::mt19937 & rand, state::State & state, state::PlayerIdentifier player)
+	{
+		state::Cards::CardData hero;
+		hero.card_id = (Cards::CardId)8;
+		hero.card_type = state::kCardTypeHero;
+		hero.zone = state::kCardZoneNewlyCreated;
+		hero.enchanted_states.max_hp = 30;
+		hero.enchanted_states.player = player;
+		hero.enchanted_states.attack = 0;
+		hero.enchantment_handler.SetOriginalStates(hero.enchanted_states);
+
+		state::CardRef hero_ref = state.AddCard(state::Cards::Card(hero));
+		state.GetZoneChanger<state::kCardTypeHero, state::kCardZoneNewlyCreated>(hero_ref)
+			.ChangeTo<state::kCardZonePlay>(player);
+		AddCard(Cards::ID_CS2_034, state, player, state::kCardZonePlay);
+
+		auto deck = decks::Decks::GetDeck(deck_name);
+		for (int i = 0; i < hand_cards; ++i) {
+			auto it = std::next(deck.begin(), rand() % deck.size());
+			AddCard((Cards::CardId)Cards::Database::GetInstance().GetIdByCardName(*it), state, player, state::kCardZoneHand);
+			deck.erase(it);
+		}
+
+		for (auto const& card_name : deck) {
+			Cards::CardId card_id = (Cards::CardId)Cards::Database::GetInstance().GetIdByCardName(card_name);
+			state.GetBoard().Get(player).deck_.ShuffleAdd(card_id, [&](int exclusive_max) {
+				return (int)(rand() % exclusive_max);
+			});
+		}
+	}
+};
@@ -0,0 +1,386 @@
+#include <assert.h>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "state/Configs.h"
+#include "engine/Game.h"
+#include "engine/Game-impl.h"
+#include "engine/FlowControl/ValidActionGetter.h"
+#include "state/BinarySerializer.h"
+#include "Cards/PreIndexedCards.h"
+#include "Cards/Database.h"
+#include "decks/Decks.h"
+
+// Engine benchmark
+//    Usage: (program) [seconds per section] [seed]
+//    Every section runs for a fixed wall time, and reports its throughput.
+//    Sections:
+//       * playout: random playouts from a fixed start board. The start board is shared by RefCopy,
+//                  as the MCTS agents do, so copy-on-write costs are included.
+//       * events: trigger event handlers borrowed from a base state; a few of them expire.
+//       * secrets: check playable cards for a hand full of secrets, with a few secrets in play.
+//       * summon: fill an empty board with minions having auras and deathrattles, on a copy of a base state.
+//       * vanilla: play a hand of vanilla minions (see Cards::CardTraits) through the flow controller.
+//       * serialize/deserialize: binary encoding of the states taken from random playouts.
+
+class RandomActionGetter : public engine::IActionParameterGetter
+{
+public:
+	RandomActionGetter(std::mt19937 & rand) : rand_(rand) {}
+
+	int GetNumber(engine::ActionType::Types action_type, engine::ActionChoices const& action_choices) final {
+		assert(!action_choices.Empty());
+		return action_choices.Get(rand_() % action_choices.Size());
+	}
+
+private:
+	std::mt19937 & rand_;
+};
+
+// Plays the first playable hand card to the leftmost position, until nothing is playable
+class PlayCardsActionGetter : public engine::IActionParameterGetter
+{
+public:
+	int GetNumber(engine::ActionType::Types action_type, engine::ActionChoices const& action_choices) final {
+		assert(!action_choices.Empty());
+		if (action_type != engine::ActionType::kMainAction) return action_choices.Get(0);
+
+		auto const& main_ops = analyzer_.GetMainActions();
+		for (int i = 0; i < analyzer_.GetMainActionsCount(); ++i) {
+			if (main_ops[i] == engine::kMainOpPlayCard) return i;
+		}
+		assert(false);
+		return 0;
+	}
+};
+
+class Benchmark
+{
+public:
+	Benchmark(double seconds) : seconds_(seconds) {}
+
+	// Functor: size_t() -- run one iteration, and return the number of operations performed
+	template <class Functor>
+	void Run(std::string const& name, std::string const& unit, Functor && functor) {
+		using Clock = std::chrono::steady_clock;
+
+		size_t iterations = 0;
+		size_t operations = 0;
+		auto start = Clock::now();
+		double elapsed = 0.0;
+		while (elapsed < seconds_) {
+			operations += functor();
+			++iterations;
+			elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+		}
+
+		std::cout << name << ": "
+			<< iterations << " iterations, "
+			<< operations << " " << unit << " in " << elapsed << "s"
+			<< " (" << (operations / elapsed) << " " << unit << "/s, "
+			<< (elapsed * 1e9 / operations) << " ns per op)" << std::endl;
+	}
+
+private:
+	double seconds_;
+};
+
+static void MakeHero(state::State & state, state::PlayerIdentifier player)
+{
+	state::Cards::CardData raw_card;
+	raw_card.card_id = (Cards::CardId)8;
+	raw_card.card_type = state::kCardTypeHero;
+	raw_card.zone = state::kCardZoneNewlyCreated;
+	raw_card.enchanted_states.max_hp = 30;
+	raw_card.enchanted_states.player = player;
+	raw_card.enchanted_states.attack = 0;
+	raw_card.enchantment_handler.SetOriginalStates(raw_card.enchanted_states);
+
+	state::CardRef ref = state.AddCard(state::Cards::Card(raw_card));
+	state.GetZoneChanger<state::kCardTypeHero, state::kCardZoneNewlyCreated>(ref)
+		.ChangeTo<state::kCardZonePlay>(player);
+
+	auto hero_power = Cards::CardDispatcher::CreateInstance(Cards::ID_CS2_034);
+	assert(hero_power.card_type == state::kCardTypeHeroPower);
+	hero_power.zone = state::kCardZoneNewlyCreated;
+	ref = state.AddCard(state::Cards::Card(hero_power));
+	state.GetZoneChanger<state::kCardTypeHeroPower, state::kCardZoneNewlyCreated>(ref)
+		.ChangeTo<state::kCardZonePlay>(player);
+}
+
+static void AddHandCard(Cards::CardId id, state::State & state, state::PlayerIdentifier player)
+{
+	state::Cards::CardData raw_card = Cards::CardDispatcher::CreateInstance(id);
+	raw_card.enchanted_states.player = player;
+	raw_card.enchantment_handler.SetOriginalStates(raw_card.enchanted_states);
+	raw_card.zone = state::kCardZoneNewlyCreated;
+
+	auto ref = state.AddCard(state::Cards::Card(raw_card));
+	state.GetZoneChanger<state::kCardZoneNewlyCreated>(ref)
+		.ChangeTo<state::kCardZoneHand>(player);
+}
+
+static void MakePlayer(std::string const& deck_name, int hand_cards, std::mt19937 & rand, state::State & state, state::PlayerIdentifier player)
+{
+	MakeHero(state, player);
+
+	auto deck = decks::Decks::GetDeck(deck_name);
+	for (int i = 0; i < hand_cards; ++i) {
+		auto it = std::next(deck.begin(), rand() % deck.size());
+		AddHandCard((Cards::CardId)Cards::Database::GetInstance().GetIdByCardName(*it), state, player);
+		deck.erase(it);
+	}
+
+	for (auto const& card_name : deck) {
+		Cards::CardId card_id = (Cards::CardId)Cards::Database::GetInstance().GetIdByCardName(card_name);
+		state.GetBoard().Get(player).deck_.ShuffleAdd(card_id, [&](int exclusive_max) {
+			return (int)(rand() % exclusive_max);
+		});
+	}
+}
+
+static state::State MakeStartState(std::mt19937 & rand)
+{
+	state::State state;
+	MakePlayer("InnKeeperExpertWarlock", 3, rand, state, state::PlayerIdentifier::First());
+	MakePlayer("InnKeeperExpertShaman", 4, rand, state, state::PlayerIdentifier::Second());
+	AddHandCard(Cards::ID_GAME_005, state, state::PlayerIdentifier::Second());
+
+	state.GetMutableCurrentPlayerId().SetFirst();
+	state.GetBoard().GetFirst().GetResource().SetTotal(1);
+	state.GetBoard().GetFirst().GetResource().Refill();
+	state.GetBoard().GetSecond().GetResource().SetTotal(0);
+	state.GetBoard().GetSecond().GetResource().Refill();
+	return state;
+}
+
+static void BenchmarkPlayouts(Benchmark & benchmark, std::mt19937 & rand)
+{
+	engine::Game start_game;
+	start_game.SetStartState(MakeStartState(rand));
+
+	RandomActionGetter action_getter(rand);
+	benchmark.Run("playout", "actions", [&]() {
+		engine::Game game;
+		game.RefCopyFrom(start_game);
+
+		size_t actions = 0;
+		while (true) {
+			action_getter.Initialize(game.GetCurrentState());
+			engine::Result result = game.PerformAction(action_getter);
+			assert(result != engine::kResultInvalid);
+			++actions;
+			if (result != engine::kResultNotDetermined) break;
+		}
+		return actions;
+	});
+}
+
+static void BenchmarkEvents(Benchmark & benchmark)
+{
+	using EventType = state::Events::EventTypes::GetPlayCardCost;
+	constexpr int kHandlers = 32;
+	constexpr int kExpireEvery = 8; // one in eight handlers expires on the first trigger
+
+	state::State base;
+	for (int i = 0; i < kHandlers; ++i) {
+		state::CardRef card_ref;
+		if (i % kExpireEvery == 0) {
+			base.AddEvent<EventType>([card_ref](EventType::Context const&) { return false; });
+		}
+		else {
+			base.AddEvent<EventType>([card_ref](EventType::Context const&) { return true; });
+		}
+	}
+
+	benchmark.Run("events", "handler calls", [&]() {
+		state::State state;
+		state.RefCopy(base);
+
+		int cost = 0;
+		bool cost_health_instead = false;
+		EventType::Context context{ state, state::CardRef(), &cost, &cost_health_instead };
+		state.TriggerEvent<EventType>(context);
+		state.TriggerEvent<EventType>(context);
+		state.CompactEvents();
+		return (size_t)(kHandlers + kHandlers - kHandlers / kExpireEvery);
+	});
+}
+
+static void BenchmarkSecrets(Benchmark & benchmark)
+{
+	std::vector<Cards::CardId> const secrets = {
+		Cards::ID_EX1_287, Cards::ID_EX1_289, Cards::ID_EX1_295, Cards::ID_EX1_294, Cards::ID_tt_010,
+		Cards::ID_EX1_594, Cards::ID_EX1_132, Cards::ID_EX1_130, Cards::ID_EX1_136, Cards::ID_EX1_379
+	};
+	constexpr size_t kSecretsInPlay = 3;
+
+	state::State state;
+	MakeHero(state, state::PlayerIdentifier::First());
+	MakeHero(state, state::PlayerIdentifier::Second());
+	for (size_t i = 0; i < secrets.size(); ++i) {
+		AddHandCard(secrets[i], state, state::PlayerIdentifier::First());
+	}
+	for (size_t i = 0; i < kSecretsInPlay; ++i) {
+		state::CardRef card_ref = state.GetBoard().GetFirst().hand_.Get(0);
+		state.GetZoneChanger<state::kCardTypeSpell, state::kCardZoneHand>(card_ref)
+			.ChangeTo<state::kCardZonePlay>(state::PlayerIdentifier::First());
+		state.GetBoard().GetFirst().secrets_.Add(secrets[i], card_ref);
+	}
+
+	state.GetMutableCurrentPlayerId().SetFirst();
+	state.GetBoard().GetFirst().GetResource().SetTotal(10);
+	state.GetBoard().GetFirst().GetResource().Refill();
+
+	engine::FlowControl::ValidActionGetter getter(state);
+	size_t const hand_cards = state.GetBoard().GetFirst().hand_.Size();
+	size_t playable = 0;
+	benchmark.Run("secrets", "playable checks", [&]() {
+		getter.ForEachPlayableCard([&](size_t) {
+			++playable;
+			return true;
+		});
+		return hand_cards;
+	});
+	assert(playable > 0);
+}
+
+static void BenchmarkSummon(Benchmark & benchmark)
+{
+	std::vector<Cards::CardId> const minions = {
+		Cards::ID_EX1_556, Cards::ID_CS2_122, Cards::ID_CS2_222, Cards::ID_EX1_565,
+		Cards::ID_EX1_162, Cards::ID_EX1_110, Cards::ID_ds1_whelptoken
+	};
+
+	state::State base;
+	MakeHero(base, state::PlayerIdentifier::First());
+	MakeHero(base, state::PlayerIdentifier::Second());
+
+	engine::FlowControl::FlowContext flow_context;
+	benchmark.Run("summon", "minions", [&]() {
+		state::State state;
+		state.RefCopy(base);
+
+		engine::FlowControl::Manipulate manipulate(state, flow_context);
+		for (size_t i = 0; i < minions.size(); ++i) {
+			manipulate.Board().SummonMinionById(minions[i], state::PlayerIdentifier::First(), (int)i);
+		}
+		assert(state.GetBoard().GetFirst().minions_.Full());
+		return minions.size();
+	});
+}
+
+static void BenchmarkVanilla(Benchmark & benchmark)
+{
+	std::vector<Cards::CardId> const minions = {
+		Cards::ID_CS2_168, Cards::ID_CS2_231, Cards::ID_CS2_172, Cards::ID_CS2_120,
+		Cards::ID_CS1_042, Cards::ID_CS2_171, Cards::ID_CS2_121
+	};
+
+	state::State base;
+	MakeHero(base, state::PlayerIdentifier::First());
+	MakeHero(base, state::PlayerIdentifier::Second());
+	for (auto card_id : minions) {
+		assert(Cards::CardDispatcher::IsVanilla(card_id));
+		AddHandCard(card_id, base, state::PlayerIdentifier::First());
+	}
+	base.GetMutableCurrentPlayerId().SetFirst();
+	base.GetBoard().GetFirst().GetResource().SetTotal(10);
+	base.GetBoard().GetFirst().GetResource().Refill();
+
+	engine::Game start_game;
+	start_game.SetStartState(base);
+
+	PlayCardsActionGetter action_getter;
+	benchmark.Run("vanilla", "minions", [&]() {
+		engine::Game game;
+		game.RefCopyFrom(start_game);
+
+		for (size_t i = 0; i < minions.size(); ++i) {
+			action_getter.Initialize(game.GetCurrentState());
+			engine::Result result = game.PerformAction(action_getter);
+			assert(result == engine::kResultNotDetermined);
+			(void)result;
+		}
+		assert(game.GetCurrentState().GetBoard().GetFirst().minions_.Full());
+		return minions.size();
+	});
+}
+
+static void BenchmarkSerializer(Benchmark & benchmark, std::mt19937 & rand)
+{
+	constexpr size_t kStates = 256;
+
+	engine::Game start_game;
+	start_game.SetStartState(MakeStartState(rand));
+
+	// Take every fourth state of random playouts
+	std::vector<std::vector<uint8_t>> encoded;
+	RandomActionGetter action_getter(rand);
+	while (encoded.size() < kStates) {
+		engine::Game game;
+		game.RefCopyFrom(start_game);
+		for (int actions = 0; encoded.size() < kStates; ++actions) {
+			if (actions % 4 == 0) {
+				encoded.emplace_back();
+				state::BinarySerializer::Serialize(game.GetCurrentState(), encoded.back());
+			}
+			action_getter.Initialize(game.GetCurrentState());
+			if (game.PerformAction(action_getter) != engine::kResultNotDetermined) break;
+		}
+	}
+
+	std::vector<state::State> states(kStates);
+	size_t total_bytes = 0;
+	for (size_t i = 0; i < kStates; ++i) {
+		state::BinarySerializer::Deserialize(encoded[i], states[i]);
+		total_bytes += encoded[i].size();
+	}
+	std::cout << "Average encoded size: " << (total_bytes / kStates) << " bytes" << std::endl;
+
+	std::vector<uint8_t> buffer;
+	size_t idx = 0;
+	benchmark.Run("serialize", "states", [&]() {
+		buffer.clear();
+		state::BinarySerializer::Serialize(states[idx], buffer);
+		idx = (idx + 1) % kStates;
+		return (size_t)1;
+	});
+
+	state::State decoded;
+	benchmark.Run("deserialize", "states", [&]() {
+		state::BinarySerializer::Deserialize(encoded[idx], decoded);
+		idx = (idx + 1) % kStates;
+		return (size_t)1;
+	});
+}
+
+int main(int argc, char ** argv)
+{
+	static_assert(!state::kOrderHandCardsByCardId); // Need to turn off this setting.
+
+	double seconds = 3.0;
+	int seed = 0;
+	if (argc > 1) seconds = std::stod(argv[1]);
+	if (argc > 2) seed = std::stoi(argv[2]);
+
+	std::cout << "Reading json file...";
+	if (!Cards::Database::GetInstance().Initialize("cards.json")) assert(false);
+	Cards::PreIndexedCards::GetInstance().Initialize();
+	std::cout << " Done." << std::endl;
+
+	std::mt19937 rand(seed);
+	Benchmark benchmark(seconds);
+
+	BenchmarkPlayouts(benchmark, rand);
+	BenchmarkEvents(benchmark);
+	BenchmarkSecrets(benchmark);
+	BenchmarkSummon(benchmark);
+	BenchmarkVanilla(benchmark);
+	BenchmarkSerializer(benchmark, rand);
+
+	return 0;
+}
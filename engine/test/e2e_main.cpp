@@ -11,6 +11,12 @@
 void test2();
 void test3();
 void test4();
+void test5();
+void test6();
+void test7();
+void test8();
+void test9();
+void test10();
 
 #ifdef _MSC_VER
 #pragma warning( push )
@@ -55,6 +61,12 @@ int main(void)
 	test2();
 	test3();
 	test4();
+	test5();
+	test6();
+	test7();
+	test8();
+	test9();
+	test10();
 
 	return 0;
 }
\ No newline at end of file
@@ -24,7 +24,7 @@ public:
 	void SetAttacker(state::CardRef attacker) { attacker_ = attacker; }
 	state::CardRef GetAttacker() { return attacker_; }
 
-	state::CardRef GetDefender(std::vector<state::CardRef> const& targets)
+	state::CardRef GetDefender(engine::FlowControl::CardRefChoices const& targets)
 	{
 		assert(next_defender_count == (int)targets.size());
 		assert(next_defender_idx >= 0);
@@ -37,7 +37,7 @@ public:
 		return next_minion_put_location;
 	}
 
-	state::CardRef GetSpecifiedTarget(state::State & state, state::CardRef card_ref, std::vector<state::CardRef> const& targets)
+	state::CardRef GetSpecifiedTarget(state::State & state, state::CardRef card_ref, engine::FlowControl::CardRefChoices const& targets)
 	{
 		assert((int)targets.size() == next_specified_target_count);
 
@@ -45,7 +45,7 @@ public:
 		else return targets[next_specified_target_idx];
 	}
 
-	Cards::CardId ChooseOne(std::vector<Cards::CardId> const& cards) {
+	Cards::CardId ChooseOne(engine::FlowControl::CardIdChoices const& cards) {
 		assert(false);
 		return cards[0];
 	}
@@ -202,7 +202,7 @@ static void CheckMinion(state::State &state, state::CardRef ref, MinionCheckStat
 
 static void CheckMinions(state::State & state, state::PlayerIdentifier player, std::vector<MinionCheckStats> const& checking)
 {
-	std::vector<state::CardRef> const& minions = state.GetBoard().Get(player).minions_.Get();
+	auto const& minions = state.GetBoard().Get(player).minions_.Get();
 
 	assert(minions.size() == checking.size());
 	for (size_t i = 0; i < minions.size(); ++i) {
@@ -0,0 +1,78 @@
+#include <assert.h>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "engine/Game.h"
+#include "engine/Game-impl.h"
+#include "RandomGameBuilder.h"
+
+// Undo: play random games, undo every action right after it is performed, and check the state is
+//    restored exactly. The action is then performed again with the same random numbers, and it
+//    should produce the same result.
+
+void test5()
+{
+	constexpr int kGames = 20;
+
+	std::mt19937 rand(1);
+	RandomActionGetter action_getter;
+
+	for (int game_idx = 0; game_idx < kGames; ++game_idx) {
+		state::State start = RandomGameBuilder::GetStartState("InnKeeperExpertWarlock", "InnKeeperExpertShaman", rand);
+
+		engine::Game base_game;
+		base_game.SetStartState(start);
+
+		// Even games are copy-on-write forks of a base, as the MCTS agents do
+		engine::Game game;
+		if (game_idx % 2 == 0) game.RefCopyFrom(base_game);
+		else game.SetStartState(start);
+		game.SetUndoEnabled(true);
+
+		auto const start_snapshot = RandomGameBuilder::GetSnapshot(game.GetCurrentState());
+		int actions = 0;
+		while (true) {
+			auto const snapshot = RandomGameBuilder::GetSnapshot(game.GetCurrentState());
+			unsigned int seed = (unsigned int)rand();
+
+			action_getter.Initialize(game.GetCurrentState());
+			action_getter.Seed(seed);
+			engine::Result result = game.PerformAction(action_getter);
+			assert(result != engine::kResultInvalid);
+			auto const performed_snapshot = RandomGameBuilder::GetSnapshot(game.GetCurrentState());
+
+			game.Undo();
+			assert(RandomGameBuilder::GetSnapshot(game.GetCurrentState()) == snapshot);
+
+			action_getter.Initialize(game.GetCurrentState());
+			action_getter.Seed(seed);
+			engine::Result replayed_result = game.PerformAction(action_getter);
+			assert(replayed_result == result);
+			assert(RandomGameBuilder::GetSnapshot(game.GetCurrentState()) == performed_snapshot);
+			(void)replayed_result;
+			(void)performed_snapshot;
+
+			++actions;
+			if (result != engine::kResultNotDetermined) break;
+		}
+
+		// Undo the whole game
+		for (int i = 0; i < actions; ++i) {
+			assert(game.CanUndo());
+			game.Undo();
+		}
+		assert(!game.CanUndo());
+		assert(RandomGameBuilder::GetSnapshot(game.GetCurrentState()) == start_snapshot);
+		(void)start_snapshot;
+
+		// An assigned game does not take over the journal, so undo is disabled as in a copy
+		engine::Game assigned;
+		assigned.SetUndoEnabled(true);
+		assigned = game;
+		action_getter.Initialize(assigned.GetCurrentState());
+		assigned.PerformAction(action_getter);
+		assert(!assigned.CanUndo());
+	}
+}
@@ -0,0 +1,101 @@
+#include <assert.h>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "engine/Game.h"
+#include "engine/Game-impl.h"
+#include "state/BinarySerializer.h"
+#include "RandomGameBuilder.h"
+
+// Binary serialization: play random games, and round-trip the state before every action.
+//    The decoded state should be encoded to the same bytes, and it should play the same as
+//    the original one with the same random numbers.
+
+static void Test6_CheckMalformed(std::vector<uint8_t> const& data)
+{
+	state::State state;
+
+	bool thrown = false;
+	try { state::BinarySerializer::Deserialize(data.data(), data.size() - 1, state); }
+	catch (std::runtime_error const&) { thrown = true; }
+	assert(thrown);
+
+	std::vector<uint8_t> bad_magic = data;
+	bad_magic[0] ^= 0xFF;
+	thrown = false;
+	try { state::BinarySerializer::Deserialize(bad_magic, state); }
+	catch (std::runtime_error const&) { thrown = true; }
+	assert(thrown);
+
+	std::vector<uint8_t> trailing = data;
+	trailing.push_back(0);
+	thrown = false;
+	try { state::BinarySerializer::Deserialize(trailing, state); }
+	catch (std::runtime_error const&) { thrown = true; }
+	assert(thrown);
+
+	// The callbacks are encoded as their ids in the code registry, so an unknown id is rejected
+	thrown = false;
+	try { Utils::CodeRegistry::Get<bool(*)()>(1); }
+	catch (std::runtime_error const&) { thrown = true; }
+	assert(thrown);
+	(void)thrown;
+}
+
+void test6()
+{
+	constexpr int kGames = 20;
+
+	std::mt19937 rand(2);
+	RandomActionGetter action_getter;
+
+	std::vector<uint8_t> data;
+	std::vector<uint8_t> data2;
+	state::State decoded; // reused, so the decoder should overwrite everything
+
+	for (int game_idx = 0; game_idx < kGames; ++game_idx) {
+		state::State start = RandomGameBuilder::GetStartState("InnKeeperExpertWarlock", "InnKeeperExpertShaman", rand);
+
+		engine::Game base_game;
+		base_game.SetStartState(start);
+
+		// Even games are copy-on-write forks of a base, so the borrowed parts are encoded as well
+		engine::Game game;
+		if (game_idx % 2 == 0) game.RefCopyFrom(base_game);
+		else game.SetStartState(start);
+
+		while (true) {
+			data.clear();
+			state::BinarySerializer::Serialize(game.GetCurrentState(), data);
+			state::BinarySerializer::Deserialize(data, decoded);
+			assert(RandomGameBuilder::GetSnapshot(decoded) == RandomGameBuilder::GetSnapshot(game.GetCurrentState()));
+
+			data2.clear();
+			state::BinarySerializer::Serialize(decoded, data2);
+			assert(data2 == data);
+
+			engine::Game decoded_game;
+			decoded_game.SetStartState(decoded);
+
+			unsigned int seed = (unsigned int)rand();
+			action_getter.Initialize(game.GetCurrentState());
+			action_getter.Seed(seed);
+			engine::Result result = game.PerformAction(action_getter);
+			assert(result != engine::kResultInvalid);
+
+			action_getter.Initialize(decoded_game.GetCurrentState());
+			action_getter.Seed(seed);
+			engine::Result decoded_result = decoded_game.PerformAction(action_getter);
+			assert(decoded_result == result);
+			assert(RandomGameBuilder::GetSnapshot(decoded_game.GetCurrentState()) == RandomGameBuilder::GetSnapshot(game.GetCurrentState()));
+			(void)decoded_result;
+
+			if (result != engine::kResultNotDetermined) break;
+		}
+	}
+
+	Test6_CheckMalformed(data);
+}
@@ -0,0 +1,49 @@
+#include <assert.h>
+#include <random>
+#include <string>
+
+#include "engine/Game.h"
+#include "engine/Game-impl.h"
+#include "AllocationCounter.h"
+#include "RandomGameBuilder.h"
+
+// Allocation-free actions: play random games twice in the same game object, and count the
+//    global allocations during the replay. Once the buffers reused by the game object have
+//    grown in the first pass, performing an action should not allocate at all.
+// Note: This is a steady-state property only. A cold game object (i.e., the first pass) does
+//    allocate, while its buffers grow; the allocations of the first pass are not checked.
+
+void test7()
+{
+	constexpr int kGames = 20;
+
+	std::mt19937 rand(3);
+	RandomActionGetter action_getter;
+
+	for (int game_idx = 0; game_idx < kGames; ++game_idx) {
+		state::State start = RandomGameBuilder::GetStartState("InnKeeperExpertWarlock", "InnKeeperBasicMage", rand);
+
+		unsigned int seed = (unsigned int)rand();
+		engine::Game game;
+
+		// The first pass warms up the buffers; the second one replays the same game
+		for (int pass = 0; pass < 2; ++pass) {
+			game.SetStartState(start);
+			action_getter.Seed(seed);
+
+			while (true) {
+				engine::Result result;
+				{
+					AllocationCounter counter;
+					action_getter.Initialize(game.GetCurrentState());
+					result = game.PerformAction(action_getter);
+					assert(pass == 0 || counter.GetCount() == 0);
+				}
+
+				assert(result != engine::kResultInvalid);
+
+				if (result != engine::kResultNotDetermined) break;
+			}
+		}
+	}
+}
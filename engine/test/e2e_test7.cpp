@@ -0,0 +1,220 @@
+#include <assert.h>
+#include <stdio.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Cards/CardDispatcher.h"
+#include "Cards/Database.h"
+#include "Cards/PreIndexedCards.h"
+
+// Compiled card database: write the loaded cards to a binary file, load it back, and check
+//    every card and the id maps are the same. Then, initialize the database with a cache path,
+//    while the cache is missing, up to date, stale, or corrupt, and check the card prototypes
+//    are rebuilt for the reloaded cards.
+
+static std::vector<Cards::Database::CardData> Test8_GetCards()
+{
+	std::vector<Cards::Database::CardData> cards;
+	Cards::Database::GetInstance().ForEachCard([&](Cards::Database::CardData const& card) {
+		cards.push_back(card);
+		return true;
+	});
+	return cards;
+}
+
+static bool Test8_Equal(Cards::Database::CardData const& lhs, Cards::Database::CardData const& rhs)
+{
+	static_assert(Cards::Database::CardData::kFieldChangeId == 3); // compare all the fields
+	if (lhs.name != rhs.name) return false;
+	if (lhs.card_id != rhs.card_id) return false;
+	if (lhs.player_class != rhs.player_class) return false;
+	if (lhs.card_type != rhs.card_type) return false;
+	if (lhs.card_race != rhs.card_race) return false;
+	if (lhs.card_rarity != rhs.card_rarity) return false;
+	if (lhs.card_set != rhs.card_set) return false;
+	if (lhs.cost != rhs.cost) return false;
+	if (lhs.attack != rhs.attack) return false;
+	if (lhs.max_hp != rhs.max_hp) return false;
+	if (lhs.collectible != rhs.collectible) return false;
+	return true;
+}
+
+static std::string Test8_ReadFile(std::string const& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	std::ostringstream ss;
+	ss << file.rdbuf();
+	return ss.str();
+}
+
+static void Test8_WriteFile(std::string const& path, std::string const& content)
+{
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	file << content;
+}
+
+static bool Test8_FileExists(std::string const& path)
+{
+	return std::ifstream(path).good();
+}
+
+static void Test8_CheckCache(std::vector<Cards::Database::CardData> const& cards)
+{
+	Cards::Database & database = Cards::Database::GetInstance();
+	std::string const json_path = "test8_cards.json";
+	std::string const cache_path = "test8_cache.bin";
+
+	std::string const json_content = Test8_ReadFile("cards.json");
+	Test8_WriteFile(json_path, json_content);
+	remove(cache_path.c_str());
+
+	auto check_cards = [&]() {
+		auto const loaded_cards = Test8_GetCards();
+		assert(loaded_cards.size() == cards.size());
+		for (size_t i = 0; i < cards.size(); ++i) {
+			assert(Test8_Equal(cards[i], loaded_cards[i]));
+		}
+	};
+
+	// The cache is written to the given path only
+	if (!database.Initialize(json_path)) assert(false);
+	assert(!database.IsLoadedFromCache());
+	assert(!Test8_FileExists(Cards::Database::GetBinaryPath(json_path)));
+
+	// Missing: the json file is parsed, and the cache is written
+	if (!database.Initialize(json_path, cache_path)) assert(false);
+	assert(!database.IsLoadedFromCache());
+	assert(Test8_FileExists(cache_path));
+	check_cards();
+
+	// Up to date: the cache is used
+	if (!database.Initialize(json_path, cache_path)) assert(false);
+	assert(database.IsLoadedFromCache());
+	check_cards();
+
+	// Stale: the json file changed in size
+	Test8_WriteFile(json_path, json_content + "\n");
+	if (!database.Initialize(json_path, cache_path)) assert(false);
+	assert(!database.IsLoadedFromCache());
+	check_cards();
+	if (!database.Initialize(json_path, cache_path)) assert(false);
+	assert(database.IsLoadedFromCache());
+
+	// Corrupt: the json file is parsed, and the cache is rewritten
+	std::string const cache_content = Test8_ReadFile(cache_path);
+	Test8_WriteFile(cache_path, cache_content.substr(0, cache_content.size() / 2));
+	if (!database.Initialize(json_path, cache_path)) assert(false);
+	assert(!database.IsLoadedFromCache());
+	check_cards();
+	assert(Test8_ReadFile(cache_path) == cache_content);
+
+	// The json file is missing: the cache is used as is
+	remove(json_path.c_str());
+	if (!database.Initialize(json_path, cache_path)) assert(false);
+	assert(database.IsLoadedFromCache());
+	check_cards();
+
+	remove(cache_path.c_str());
+	assert(!database.Initialize(json_path, cache_path));
+}
+
+void test8()
+{
+	Cards::Database & database = Cards::Database::GetInstance();
+	std::string const path = "test8_cards.bin";
+
+	auto const cards = Test8_GetCards();
+	auto const id_map = database.GetIdMap();
+	int const id = database.GetIdByCardName("Fireball");
+
+	if (!database.SaveBinaryFile(path)) assert(false);
+	if (!database.LoadBinaryFile(path)) assert(false);
+	remove(path.c_str());
+
+	auto const loaded_cards = Test8_GetCards();
+	assert(loaded_cards.size() == cards.size());
+	for (size_t i = 0; i < cards.size(); ++i) {
+		assert(Test8_Equal(cards[i], loaded_cards[i]));
+	}
+	assert(database.GetIdMap() == id_map);
+	assert(database.GetIdByCardName("Fireball") == id);
+
+	// A missing or malformed file is rejected, and the loaded cards are kept
+	assert(!database.LoadBinaryFile(path));
+	assert(!database.LoadBinaryFile("cards.json"));
+	assert(Test8_GetCards().size() == cards.size());
+
+	// The card prototypes are rebuilt once the cards are reloaded; the outdated ones are kept alive
+	state::Cards::Card const& prototype = Cards::CardDispatcher::GetPrototype(Cards::ID_CS2_029, state::PlayerIdentifier::First());
+	int const generation = database.GetGeneration();
+
+	Test8_CheckCache(cards);
+	if (!database.Initialize("cards.json")) assert(false);
+
+	assert(database.GetGeneration() > generation);
+	state::Cards::Card const& new_prototype = Cards::CardDispatcher::GetPrototype(Cards::ID_CS2_029, state::PlayerIdentifier::First());
+	assert(&new_prototype != &prototype);
+	assert(new_prototype.GetCost() == database.Get(Cards::ID_CS2_029).cost);
+	assert(prototype.GetCardId() == new_prototype.GetCardId());
+	assert(&Cards::CardDispatcher::GetPrototype(Cards::ID_CS2_029, state::PlayerIdentifier::First()) == &new_prototype);
+	(void)generation;
+}
+
+// Card pools: compare the intersections of the indexed pools with a scan over the database
+
+static Cards::CardIdSet Test9_Scan(int cost, state::PlayerClass player_class, state::CardType card_type, state::CardRace card_race)
+{
+	Cards::CardIdSet cards;
+	Cards::Database::GetInstance().ForEachCard([&](Cards::Database::CardData const& card) {
+		if (!card.collectible) return true;
+		if (std::min(card.cost, Cards::PreIndexedCards::kMaxIndexedCost) != cost) return true;
+		if (card.player_class != player_class) return true;
+		if (card.card_type != card_type) return true;
+		if (card.card_race != card_race) return true;
+		cards.Add((Cards::CardId)card.card_id);
+		return true;
+	});
+	return cards;
+}
+
+void test9()
+{
+	Cards::PreIndexedCards const& pools = Cards::PreIndexedCards::GetInstance();
+
+	state::CardRace const races[] = { state::kCardRaceInvalid, state::kCardRaceBeast, state::kCardRaceDemon, state::kCardRaceMurloc };
+	state::PlayerClass const classes[] = { state::kPlayerClassNeutral, state::kPlayerClassHunter, state::kPlayerClassWarlock };
+
+	int total = 0;
+	for (int cost = 0; cost <= Cards::PreIndexedCards::kMaxIndexedCost; ++cost) {
+		for (auto player_class : classes) {
+			for (auto card_race : races) {
+				Cards::CardIdSet const cards = pools.GetCollectibles() & pools.GetByCost(cost) &
+					pools.GetByClass(player_class) & pools.GetByType(state::kCardTypeMinion) & pools.GetByRace(card_race);
+				Cards::CardIdSet const expected = Test9_Scan(cost, player_class, state::kCardTypeMinion, card_race);
+
+				int count = 0;
+				expected.ForEach([&](Cards::CardId card_id) {
+					assert(cards.Contains(card_id));
+					assert(cards.Get(count) == card_id);
+					++count;
+					return true;
+				});
+				assert(cards.Count() == count);
+				assert(cards.Empty() == (count == 0));
+				total += count;
+			}
+		}
+	}
+	assert(total > 0);
+
+	// The pools kept as arrays are in the increasing order of card ids
+	Cards::CardIdSet const demons = pools.GetByType(state::kCardTypeMinion) & pools.GetByRace(state::kCardRaceDemon);
+	auto const& indexed_demons = Cards::PreIndexedCards::GetInstance().GetIndexedCards(Cards::PreIndexedCards::kMinionDemons);
+	assert((int)indexed_demons.size() == demons.Count());
+	for (size_t i = 0; i < indexed_demons.size(); ++i) {
+		assert(indexed_demons[i] == (int)demons.Get((int)i));
+	}
+}
@@ -0,0 +1,149 @@
+#include <assert.h>
+#include <random>
+#include <string>
+
+#include "engine/Game.h"
+#include "engine/Game-impl.h"
+#include "engine/FlowControl/ValidActionGetter.h"
+#include "RandomGameBuilder.h"
+
+// State caches: play random games, and check the caches kept in the state against the cards
+//    before every action. Each cache is also checked after a change it should notice.
+//    Note: debug builds additionally cross-check each cache with a full recompute.
+
+static void Test10_CheckBoardHash(state::State const& state)
+{
+	uint64_t first_hash = state.GetBoardHash(state::kPlayerFirst);
+	uint64_t second_hash = state.GetBoardHash(state::kPlayerSecond);
+
+	// A copy-on-write fork has the same hash
+	state::State fork;
+	fork.RefCopy(state);
+	assert(fork.GetBoardHash(state::kPlayerFirst) == first_hash);
+	assert(fork.GetBoardHash(state::kPlayerSecond) == second_hash);
+
+	// The hand cards are hidden from the opponent
+	auto const& hand = state.GetBoard().GetFirst().hand_;
+	if (hand.Empty()) return;
+
+	state::CardRef card_ref = hand.Get(0);
+	fork.GetMutableCard(card_ref).SetCost(fork.GetCard(card_ref).GetCost() + 1);
+	assert(fork.GetBoardHash(state::kPlayerFirst) != first_hash);
+	assert(fork.GetBoardHash(state::kPlayerSecond) == second_hash);
+	(void)first_hash;
+	(void)second_hash;
+}
+
+static void Test10_CheckCharacterStats(state::State const& state, state::PlayerIdentifier player)
+{
+	auto const& stats = state.GetCharacterStats(player);
+	auto const& minions = state.GetBoard().Get(player).minions_.Get();
+	(void)stats;
+
+	assert(stats.minions_count == (int)minions.size());
+	for (size_t i = 0; i < minions.size(); ++i) {
+		auto const& card = state.GetCard(minions[i]);
+		(void)card;
+		assert(stats.refs[i] == minions[i]);
+		assert(stats.attack[i] == card.GetAttack());
+		assert(stats.hp[i] == card.GetHP());
+		assert(stats.max_hp[i] == card.GetMaxHP());
+		assert(stats.HasFlag((int)i, state::board::CharacterStats::kFlagTaunt) == card.HasTaunt());
+		assert(stats.HasFlag((int)i, state::board::CharacterStats::kFlagShield) == card.HasShield());
+	}
+	assert(stats.refs[state::board::CharacterStats::kHeroIndex] == state.GetBoard().Get(player).GetHeroRef());
+}
+
+static void Test10_CheckCharacterStatsSync(state::State const& state, state::PlayerIdentifier player)
+{
+	// The stats are synced from the modified cards only; the other slots are kept
+	state::State copy = state;
+	auto const& minions = copy.GetBoard().Get(player).minions_.Get();
+	if (!minions.empty()) {
+		bool immune = copy.GetCharacterStats(player).HasFlag(0, state::board::CharacterStats::kFlagImmune);
+		copy.GetMutableCard(minions[0]).SetImmune(!immune);
+		assert(copy.GetCharacterStats(player).HasFlag(0, state::board::CharacterStats::kFlagImmune) == !immune);
+		Test10_CheckCharacterStats(copy, player);
+		(void)immune;
+
+		state::CardRef last = minions[minions.size() - 1];
+		copy.GetMutableCard(last).SetAttack(copy.GetCard(last).GetAttack() + 1);
+		assert(copy.GetCharacterStats(player).attack[minions.size() - 1] == copy.GetCard(last).GetAttack());
+		Test10_CheckCharacterStats(copy, player);
+	}
+
+	state::CardRef hero_ref = copy.GetBoard().Get(player).GetHeroRef();
+	copy.GetMutableCard(hero_ref).SetAttack(copy.GetCard(hero_ref).GetAttack() + 2);
+	assert(copy.GetCharacterStats(player).attack[state::board::CharacterStats::kHeroIndex] == copy.GetCard(hero_ref).GetAttack());
+	Test10_CheckCharacterStats(copy, player);
+
+	// The weapon decides if the hero is attackable
+	state::CardRef weapon_ref = copy.GetBoard().Get(player).GetWeaponRef();
+	if (weapon_ref.IsValid()) {
+		copy.GetMutableCard(weapon_ref).SetAttack(copy.GetCard(weapon_ref).GetAttack() + 1);
+		Test10_CheckCharacterStats(copy, player);
+	}
+}
+
+// @return The playable cards, without the cache in the state
+static uint32_t Test10_ComputePlayableMask(state::State const& state)
+{
+	engine::FlowControl::ValidActionGetter getter(state);
+	uint32_t mask = 0;
+	for (size_t idx = 0; idx < state.GetCurrentPlayer().hand_.Size(); ++idx) {
+		if (getter.IsPlayable(idx)) mask |= 1u << idx;
+	}
+	return mask;
+}
+
+static void Test10_CheckPlayableCards(state::State const& state)
+{
+	uint32_t mask = engine::FlowControl::ValidActionGetter(state).GetPlayableCardsMask();
+	assert(mask == Test10_ComputePlayableMask(state));
+	assert(engine::FlowControl::ValidActionGetter(state).GetPlayableCardsMask() == mask); // from the cache
+
+	// An event handler can make a card affordable, while no card is changed
+	state::State copy = state;
+	copy.AddEvent<state::Events::EventTypes::GetPlayCardCost>(
+		[](state::Events::EventTypes::GetPlayCardCost::Context const& context) {
+		*context.cost_ = 0;
+		return true;
+	});
+
+	uint32_t free_mask = engine::FlowControl::ValidActionGetter(copy).GetPlayableCardsMask();
+	assert(free_mask == Test10_ComputePlayableMask(copy));
+	assert((free_mask & mask) == mask);
+	(void)mask;
+	(void)free_mask;
+}
+
+void test10()
+{
+	constexpr int kGames = 10;
+
+	std::mt19937 rand(4);
+	RandomActionGetter action_getter;
+
+	for (int game_idx = 0; game_idx < kGames; ++game_idx) {
+		state::State start = RandomGameBuilder::GetStartState("InnKeeperExpertWarlock", "InnKeeperBasicMage", rand);
+
+		engine::Game game;
+		game.SetStartState(start);
+
+		while (true) {
+			state::State const& state = game.GetCurrentState();
+			Test10_CheckBoardHash(state);
+			for (auto player : { state::PlayerIdentifier::First(), state::PlayerIdentifier::Second() }) {
+				Test10_CheckCharacterStats(state, player);
+				Test10_CheckCharacterStatsSync(state, player);
+			}
+			Test10_CheckPlayableCards(state);
+
+			action_getter.Seed((unsigned int)rand());
+			action_getter.Initialize(state);
+			engine::Result result = game.PerformAction(action_getter);
+			assert(result != engine::kResultInvalid);
+			if (result != engine::kResultNotDetermined) break;
+		}
+	}
+}
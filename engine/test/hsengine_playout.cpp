@@ -0,0 +1,137 @@
+#include <assert.h>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "engine/Engine.h"
+#include "decks/Decks.h"
+
+// Random playouts through the public header of the compiled engine library
+//    Usage: (program) [games] [seed]
+// Checks the library is usable without the -impl headers, and serves as the training run
+//    of the profile-guided build (see engine/build/gcc7/hsengine/Makefile).
+
+class PlayoutActionGetter : public engine::IActionParameterGetter
+{
+public:
+	PlayoutActionGetter(std::mt19937 & rand) : rand_(rand), analyzer_() {}
+
+	int GetNumber(engine::ActionType::Types action_type, engine::ActionChoices const& action_choices) final {
+		assert(!action_choices.Empty());
+		if (action_type == engine::ActionType::kMainAction) {
+			assert((int)action_choices.Size() == analyzer_.GetMainActionsCount());
+		}
+		return action_choices.Get(rand_() % action_choices.Size());
+	}
+
+	void Prepare(state::State const& state) {
+		Initialize(state);
+		analyzer_.Analyze(state);
+	}
+
+private:
+	std::mt19937 & rand_;
+	engine::ValidActionAnalyzer analyzer_;
+};
+
+static void AddCard(Cards::CardId id, state::State & state, state::PlayerIdentifier player, state::CardZone zone)
+{
+	state::Cards::CardData raw_card = Cards::CardDispatcher::CreateInstance(id);
+	raw_card.enchanted_states.player = player;
+	raw_card.enchantment_handler.SetOriginalStates(raw_card.enchanted_states);
+	raw_card.zone = state::kCardZoneNewlyCreated;
+
+	auto ref = state.AddCard(state::Cards::Card(raw_card));
+	if (zone == state::kCardZoneHand) {
+		state.GetZoneChanger<state::kCardZoneNewlyCreated>(ref)
+			.ChangeTo<state::kCardZoneHand>(player);
+	}
+	else {
+		assert(raw_card.card_type == state::kCardTypeHeroPower);
+		state.GetZoneChanger<state::kCardTypeHeroPower, state::kCardZoneNewlyCreated>(ref)
+			.ChangeTo<state::kCardZonePlay>(player);
+	}
+}
+
+static void MakePlayer(std::string const& deck_name, int hand_cards, std::mt19937 & rand, state::State & state, state::PlayerIdentifier player)
+{
+	state::Cards::CardData hero;
+	hero.card_id = (Cards::CardId)8;
+	hero.card_type = state::kCardTypeHero;
+	hero.zone = state::kCardZoneNewlyCreated;
+	hero.enchanted_states.max_hp = 30;
+	hero.enchanted_states.player = player;
+	hero.enchanted_states.attack = 0;
+	hero.enchantment_handler.SetOriginalStates(hero.enchanted_states);
+
+	state::CardRef hero_ref = state.AddCard(state::Cards::Card(hero));
+	state.GetZoneChanger<state::kCardTypeHero, state::kCardZoneNewlyCreated>(hero_ref)
+		.ChangeTo<state::kCardZonePlay>(player);
+	AddCard(Cards::ID_CS2_034, state, player, state::kCardZonePlay);
+
+	auto deck = decks::Decks::GetDeck(deck_name);
+	for (int i = 0; i < hand_cards; ++i) {
+		auto it = std::next(deck.begin(), rand() % deck.size());
+		AddCard((Cards::CardId)Cards::Database::GetInstance().GetIdByCardName(*it), state, player, state::kCardZoneHand);
+		deck.erase(it);
+	}
+
+	for (auto const& card_name : deck) {
+		Cards::CardId card_id = (Cards::CardId)Cards::Database::GetInstance().GetIdByCardName(card_name);
+		state.GetBoard().Get(player).deck_.ShuffleAdd(card_id, [&](int exclusive_max) {
+			return (int)(rand() % exclusive_max);
+		});
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	int games = 1000;
+	int seed = 0;
+	if (argc > 1) games = std::stoi(argv[1]);
+	if (argc > 2) seed = std::stoi(argv[2]);
+
+	if (!Cards::Database::GetInstance().Initialize("cards.json")) {
+		std::cerr << "Failed to initialize card database." << std::endl;
+		return 1;
+	}
+	Cards::PreIndexedCards::GetInstance().Initialize();
+
+	std::string const decks[] = {
+		"InnKeeperExpertWarlock", "InnKeeperExpertShaman", "InnKeeperBasicMage", "InnKeeperBasicPaladin"
+	};
+
+	std::mt19937 rand(seed);
+	PlayoutActionGetter action_getter(rand);
+
+	size_t actions = 0;
+	int first_player_wins = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int game_idx = 0; game_idx < games; ++game_idx) {
+		state::State start_state;
+		MakePlayer(decks[game_idx % 4], 3, rand, start_state, state::PlayerIdentifier::First());
+		MakePlayer(decks[(game_idx / 4) % 4], 4, rand, start_state, state::PlayerIdentifier::Second());
+		start_state.GetMutableCurrentPlayerId().SetFirst();
+		start_state.GetBoard().GetFirst().GetResource().SetTotal(1);
+		start_state.GetBoard().GetFirst().GetResource().Refill();
+
+		engine::Game game;
+		game.SetStartState(start_state);
+		while (true) {
+			action_getter.Prepare(game.GetCurrentState());
+			engine::Result result = game.PerformAction(action_getter);
+			assert(result != engine::kResultInvalid);
+			++actions;
+
+			if (result == engine::kResultFirstPlayerWin) ++first_player_wins;
+			if (result != engine::kResultNotDetermined) break;
+		}
+	}
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << games << " games, " << actions << " actions in " << elapsed << "s"
+		<< " (" << (actions / elapsed) << " actions/s); "
+		<< "first player wins " << first_player_wins << std::endl;
+	return 0;
+}
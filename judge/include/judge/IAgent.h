@@ -24,6 +24,6 @@ namespace judge
 		// Should pass engine/view/BoardView instead. Agents can use state-restorer to sample a determined state
 		virtual void Think(state::PlayerIdentifier side, std::function<state::State(int)> state_getter, std::mt19937 & random) = 0;
 
-		virtual int GetAction(engine::ActionType::Types action_type, engine::ActionChoices action_choices) = 0;
+		virtual int GetAction(engine::ActionType::Types action_type, engine::ActionChoices const& action_choices) = 0;
 	};
 }
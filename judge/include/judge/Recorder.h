@@ -36,17 +36,16 @@ namespace judge
 			json_.append(obj);
 		}
 
-		void RecordManualAction(engine::ActionType::Types action_type, engine::ActionChoices action_choices, int action) {
+		void RecordManualAction(engine::ActionType::Types action_type, engine::ActionChoices const& action_choices, int action) {
 			Json::Value obj;
 			obj["type"] = GetActionTypeString(action_type);
 			obj["choices_type"] = GetChoiceTypeString(action_choices);
 
 			Json::Value choices;
-			for (action_choices.Begin(); !action_choices.IsEnd(); action_choices.StepNext()) {
-				Json::Value choice;
-				choice = action_choices.Get();
-				choices.append(choice);
-			}
+			action_choices.ForEach([&](int choice) {
+				choices.append(Json::Value(choice));
+				return true;
+			});
 			obj["choices"] = choices;
 
 			obj["choice"] = action;